@@ -0,0 +1,36 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <limits>
+
+/// Small helpers shared by the benchmark executables.
+namespace Bench {
+
+using Clock = std::chrono::steady_clock;
+
+/// Milliseconds elapsed since start.
+inline double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+/// Run fn `runs` times and return the fastest run in milliseconds.
+/// The minimum is the least noisy estimate on a shared machine.
+template <typename Fn>
+double bestOf(int runs, Fn&& fn) {
+    double best = std::numeric_limits<double>::infinity();
+    for (int run = 0; run < runs; ++run) {
+        const Clock::time_point start = Clock::now();
+        fn();
+        best = std::min(best, elapsedMs(start));
+    }
+    return best;
+}
+
+/// Parse argv[index] as an integer, or return fallback if it is missing.
+inline long argOr(int argc, char** argv, int index, long fallback) {
+    return index < argc ? std::strtol(argv[index], nullptr, 10) : fallback;
+}
+
+} // namespace Bench
@@ -0,0 +1,100 @@
+// Randomised check that the batch checkAABB() matches the scalar one.
+//
+// Every batch is compared rect by rect against Collision::checkAABB(a, b):
+// hit bit, overlap bits (not just values, so signed zeros count) and the
+// hit count. Batch sizes run from 0 (empty) past 64 (several mask words,
+// vector loop plus scalar tail). Coordinates mix ordinary values with
+// exact ties, duplicates, signed zeros, denormals, huge values, infinities
+// and NaNs. Exits with 1 on the first batch that differs.
+//
+// Usage: CollisionBatchFuzz [batches=20000] [seed=1]
+
+#include "BenchCommon.hpp"
+#include "Example/Physics/Collision.hpp"
+#include <bit>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+float randomValue(std::mt19937& rng) {
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    static const float special[] = {0.f, -0.f, 1.f, -1.f, 0.5f, 8.f, 16.f, 1e-40f, -1e-40f,
+                                    1e30f, -1e30f, inf, -inf, std::numeric_limits<float>::quiet_NaN()};
+    switch (rng() % 8) {
+    case 0:
+        return special[rng() % std::size(special)];
+    case 1:
+        // Small integers: exact ties between overlaps on both axes
+        return static_cast<float>(static_cast<int>(rng() % 17) - 8);
+    default:
+        return std::uniform_real_distribution<float>(-50.f, 50.f)(rng);
+    }
+}
+
+sf::FloatRect randomRect(std::mt19937& rng) {
+    return {{randomValue(rng), randomValue(rng)}, {randomValue(rng), randomValue(rng)}};
+}
+
+bool sameBits(float a, float b) {
+    return std::bit_cast<std::uint32_t>(a) == std::bit_cast<std::uint32_t>(b);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const long batches = Bench::argOr(argc, argv, 1, 20000);
+    std::mt19937 rng(static_cast<std::uint32_t>(Bench::argOr(argc, argv, 2, 1)));
+
+    Example::AABBBatch batch;
+    Example::BatchCollisionResult result;
+    std::vector<sf::FloatRect> rects;
+    std::size_t tested = 0;
+    std::size_t hits = 0;
+
+    for (long n = 0; n < batches; ++n) {
+        const sf::FloatRect a = randomRect(rng);
+        const std::size_t count = rng() % 140;
+
+        batch.clear();
+        rects.clear();
+        for (std::size_t i = 0; i < count; ++i) {
+            // Some duplicates of earlier rects and of `a` itself
+            const std::uint32_t pick = rng() % 10;
+            const sf::FloatRect rect = (pick == 0 && !rects.empty()) ? rects[rng() % rects.size()]
+                                     : pick == 1                     ? a
+                                                                     : randomRect(rng);
+            rects.push_back(rect);
+            batch.add(rect);
+        }
+
+        Example::Collision::checkAABB(a, batch, result);
+
+        std::size_t expectedCount = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            const Example::CollisionResult expected = Example::Collision::checkAABB(a, rects[i]);
+            expectedCount += expected.colliding;
+            if (expected.colliding != result.isColliding(i)
+                || !sameBits(expected.overlap.x, result.overlaps[i].x)
+                || !sameBits(expected.overlap.y, result.overlaps[i].y)) {
+                std::printf("MISMATCH in batch %ld, rect %zu of %zu: scalar %d (%g, %g), batch %d (%g, %g)\n",
+                            n, i, count, expected.colliding, static_cast<double>(expected.overlap.x),
+                            static_cast<double>(expected.overlap.y), result.isColliding(i),
+                            static_cast<double>(result.overlaps[i].x), static_cast<double>(result.overlaps[i].y));
+                return 1;
+            }
+        }
+        if (result.count != expectedCount || result.overlaps.size() != count) {
+            std::printf("MISMATCH in batch %ld: %zu hits counted, %zu expected\n", n, result.count, expectedCount);
+            return 1;
+        }
+        tested += count;
+        hits += expectedCount;
+    }
+
+    std::printf("%ld batches, %zu rects, %zu hits: batch matches scalar\n", batches, tested, hits);
+    return 0;
+}
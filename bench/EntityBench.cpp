@@ -0,0 +1,121 @@
+// 100k-entity update throughput: the original heap-allocated Entity class
+// vs the registry-backed Entity facade vs a plain registry view.
+//
+// Each case integrates position += velocity * dt for every entity. The
+// "legacy" case reproduces the class as it was before the registry (data
+// members on the heap object, one virtual update() per entity), inserted
+// in shuffled order like long-lived game objects.
+//
+// Usage: EntityBench [entities=100000] [runs=20]
+
+#include "BenchCommon.hpp"
+#include "Engine/ECS/Components.hpp"
+#include "Engine/ECS/Registry.hpp"
+#include "Example/Entities/Entity.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr float Dt = 1.f / 60.f;
+
+/// The Entity class before the registry, reduced to what update() touches.
+class LegacyEntity {
+public:
+    LegacyEntity(sf::Vector2f position, sf::Vector2f velocity)
+        : m_position(position), m_velocity(velocity) {}
+    virtual ~LegacyEntity() = default;
+
+    virtual void update(float dt) { m_position += m_velocity * dt; }
+    [[nodiscard]] sf::Vector2f getPosition() const { return m_position; }
+
+private:
+    sf::Vector2f m_position;
+    sf::Vector2f m_velocity;
+    sf::Vector2f m_size;
+    bool m_alive = true;
+};
+
+class FacadeEntity : public Example::Entity {
+public:
+    using Example::Entity::Entity;
+    void draw(Engine::Renderer&) override {}
+};
+
+template <typename Objects>
+void shuffleAllocations(Objects& objects) {
+    std::mt19937 rng(42);
+    std::shuffle(objects.begin(), objects.end(), rng);
+}
+
+void report(const char* name, std::size_t count, double ms, float checksum) {
+    std::printf("  %-10s %9.3f ms  %8.1f M entities/s  (checksum %.1f)\n",
+                name, ms, static_cast<double>(count) / ms / 1000.0, static_cast<double>(checksum));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const auto count = static_cast<std::size_t>(Bench::argOr(argc, argv, 1, 100000));
+    const int runs = static_cast<int>(Bench::argOr(argc, argv, 2, 20));
+
+    std::vector<sf::Vector2f> velocities(count);
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> speed(-100.f, 100.f);
+    for (sf::Vector2f& v : velocities) v = {speed(rng), speed(rng)};
+
+    std::printf("%zu entities, best of %d updates\n", count, runs);
+
+    {
+        // Allocate interleaved with throwaway blocks, then shuffle, so the
+        // objects are scattered like in a long-running game
+        std::vector<std::unique_ptr<LegacyEntity>> entities;
+        std::vector<std::unique_ptr<char[]>> noise;
+        for (std::size_t i = 0; i < count; ++i) {
+            entities.push_back(std::make_unique<LegacyEntity>(sf::Vector2f{}, velocities[i]));
+            noise.push_back(std::make_unique<char[]>(64));
+        }
+        shuffleAllocations(entities);
+
+        const double ms = Bench::bestOf(runs, [&] {
+            for (const auto& entity : entities) entity->update(Dt);
+        });
+        report("legacy", count, ms, entities.front()->getPosition().x);
+    }
+
+    {
+        Engine::Registry registry;
+        std::vector<std::unique_ptr<Example::Entity>> entities;
+        for (std::size_t i = 0; i < count; ++i) {
+            auto entity = std::make_unique<FacadeEntity>(registry);
+            entity->setVelocity(velocities[i]);
+            entities.push_back(std::move(entity));
+        }
+        shuffleAllocations(entities);
+
+        const double ms = Bench::bestOf(runs, [&] {
+            for (const auto& entity : entities) entity->update(Dt);
+        });
+        report("facade", count, ms, entities.front()->getPosition().x);
+    }
+
+    {
+        Engine::Registry registry;
+        registry.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const Engine::EntityId id = registry.create();
+            registry.emplace<Engine::Position>(id);
+            registry.emplace<Engine::Velocity>(id, velocities[i]);
+        }
+
+        auto view = registry.view<Engine::Position, Engine::Velocity>();
+        const double ms = Bench::bestOf(runs, [&] {
+            view.each([](Engine::Position& p, const Engine::Velocity& v) { p.value += v.value * Dt; });
+        });
+        report("registry", count, ms, registry.storage<Engine::Position>().data()[0].value.x);
+    }
+    return 0;
+}
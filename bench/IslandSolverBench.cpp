@@ -0,0 +1,83 @@
+// IslandSolver scaling: one solve() of N bodies stacked in piles, on 1, 2,
+// 4, ... threads up to the given thread count.
+//
+// Each pile is a column of overlapping 16x16 boxes resting on one static
+// floor shared by every pile; the floor does not join islands, so each
+// pile is one island. Pairs come from SpatialHash once; every run restores
+// the starting bounds and solves them again. Results must be bit-identical
+// to the single-threaded run whatever the thread count.
+//
+// Usage: IslandSolverBench [bodies=20000] [threads=0 (one per hardware thread)]
+//                          [pileHeight=50] [runs=20]
+
+#include "BenchCommon.hpp"
+#include "Engine/Core/ThreadPool.hpp"
+#include "Example/Physics/IslandSolver.hpp"
+#include "Example/Physics/SpatialHash.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv) {
+    const auto bodies = static_cast<std::size_t>(std::max(Bench::argOr(argc, argv, 1, 20000), 1L));
+    long maxThreads = Bench::argOr(argc, argv, 2, 0);
+    if (maxThreads <= 0) maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    const auto pileHeight = static_cast<std::size_t>(std::max(Bench::argOr(argc, argv, 3, 50), 1L));
+    const int runs = static_cast<int>(Bench::argOr(argc, argv, 4, 20));
+
+    // Boxes overlap the one below by 2 units, with a little sideways jitter
+    constexpr float BoxSize = 16.f;
+    constexpr float PileSpacing = 40.f;
+    const std::size_t piles = (bodies + pileHeight - 1) / pileHeight;
+    const float floorY = static_cast<float>(pileHeight) * (BoxSize - 2.f);
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> jitter(-3.f, 3.f);
+    std::vector<sf::FloatRect> start;
+    std::vector<float> inverseMasses;
+    for (std::size_t i = 0; i < bodies; ++i) {
+        const std::size_t pile = i / pileHeight;
+        const std::size_t level = i % pileHeight;
+        const float x = static_cast<float>(pile) * PileSpacing + jitter(rng);
+        const float y = floorY - static_cast<float>(level + 1) * (BoxSize - 2.f);
+        start.push_back({{x, y}, {BoxSize, BoxSize}});
+        inverseMasses.push_back(1.f);
+    }
+    start.push_back({{-PileSpacing, floorY - 2.f}, {static_cast<float>(piles + 1) * PileSpacing, BoxSize}});
+    inverseMasses.push_back(0.f);
+
+    Example::SpatialHash hash(32.f);
+    hash.insertBounds(start);
+    const std::vector<Example::CollisionPair> pairs(hash.pairs().begin(), hash.pairs().end());
+
+    std::printf("%zu bodies in %zu piles, %zu pairs, best of %d solves\n", bodies, piles, pairs.size(), runs);
+
+    std::vector<sf::FloatRect> reference;
+    double single = 0.0;
+    for (long threads = 1;; threads = std::min(threads * 2, maxThreads)) {
+        Engine::ThreadPool pool(static_cast<unsigned int>(threads));
+        Example::IslandSolver solver(&pool);
+
+        std::vector<sf::FloatRect> bounds;
+        const double ms = Bench::bestOf(runs, [&] {
+            bounds = start;
+            solver.solve(bounds, inverseMasses, pairs);
+        });
+
+        if (reference.empty()) {
+            reference = bounds;
+            single = ms;
+        }
+        const bool identical = std::memcmp(bounds.data(), reference.data(),
+                                           bounds.size() * sizeof(sf::FloatRect)) == 0;
+
+        std::printf("  %3ld threads: %8.3f ms  %5.2fx  (%zu islands, largest %zu pairs)%s\n", threads, ms,
+                    single / ms, solver.getIslandCount(), solver.getLargestIslandSize(),
+                    identical ? "" : "  MISMATCH");
+        if (threads == maxThreads) break;
+    }
+    return 0;
+}
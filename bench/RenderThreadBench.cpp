@@ -0,0 +1,72 @@
+// Single-threaded vs threaded rendering on a draw-heavy scene.
+//
+// Each frame simulates `update` microseconds of game logic, then draws
+// `sprites` unbatched sprites and presents. Threaded, the render thread
+// submits frame N while the main thread updates and records frame N+1, so
+// the frame time approaches max(update, draw) instead of their sum.
+//
+// Usage: RenderThreadBench [sprites=20000] [frames=300] [update_us=4000]
+// Renders offscreen (no window), but still needs an OpenGL context.
+
+#include "BenchCommon.hpp"
+#include "Engine/Graphics/Renderer.hpp"
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+/// Busy-wait, standing in for physics and scene updates.
+void simulateUpdate(long microseconds) {
+    const Bench::Clock::time_point end = Bench::Clock::now() + std::chrono::microseconds(microseconds);
+    while (Bench::Clock::now() < end) {
+    }
+}
+
+double runFrames(Engine::Renderer& renderer, const std::vector<sf::Sprite>& sprites,
+                 long frames, long updateUs) {
+    const Bench::Clock::time_point start = Bench::Clock::now();
+    for (long frame = 0; frame < frames; ++frame) {
+        simulateUpdate(updateUs);
+        renderer.clear();
+        for (const sf::Sprite& sprite : sprites) {
+            renderer.draw(sprite);
+        }
+        renderer.display();
+    }
+    return Bench::elapsedMs(start) / static_cast<double>(frames);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const long spriteCount = Bench::argOr(argc, argv, 1, 20000);
+    const long frames = Bench::argOr(argc, argv, 2, 300);
+    const long updateUs = Bench::argOr(argc, argv, 3, 4000);
+
+    Engine::Renderer renderer(1280, 720, "RenderThreadBench", Engine::RenderMode::Offscreen);
+
+    const sf::Image image({16, 16}, sf::Color::White);
+    sf::Texture texture;
+    if (!texture.loadFromImage(image)) {
+        std::fprintf(stderr, "RenderThreadBench: Failed to create texture\n");
+        return 1;
+    }
+
+    std::vector<sf::Sprite> sprites;
+    sprites.reserve(static_cast<std::size_t>(spriteCount));
+    for (long i = 0; i < spriteCount; ++i) {
+        sf::Sprite& sprite = sprites.emplace_back(texture);
+        sprite.setPosition({static_cast<float>(i * 37 % 1264), static_cast<float>(i * 91 % 704)});
+    }
+
+    std::printf("%ld sprites, %ld frames, %ld us update per frame\n", spriteCount, frames, updateUs);
+
+    const double serial = runFrames(renderer, sprites, frames, updateUs);
+    std::printf("  single-threaded: %8.3f ms/frame\n", serial);
+
+    renderer.setThreadedRendering(true);
+    const double threaded = runFrames(renderer, sprites, frames, updateUs);
+    renderer.setThreadedRendering(false);
+    std::printf("  threaded:        %8.3f ms/frame  (%.2fx)\n", threaded, serial / threaded);
+    return 0;
+}
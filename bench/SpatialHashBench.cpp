@@ -0,0 +1,81 @@
+// Spatial hash broadphase: clear() + insert() + pairs() per tick for N
+// moving AABBs, against the 2 ms target for 50k objects on one core.
+//
+// Objects of 4-24 units are spread over a square world and jitter a little
+// every tick. The pairs are checked against brute force once (O(n^2), so
+// only for small counts or when asked).
+//
+// Usage: SpatialHashBench [objects=50000] [world=4000] [ticks=50] [verify=0]
+
+#include "BenchCommon.hpp"
+#include "Example/Physics/SpatialHash.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+bool verify(Example::SpatialHash& hash, const std::vector<sf::FloatRect>& boxes) {
+    std::vector<Example::CollisionPair> expected;
+    for (std::uint32_t a = 0; a < boxes.size(); ++a) {
+        for (std::uint32_t b = a + 1; b < boxes.size(); ++b) {
+            if (boxes[a].position.x < boxes[b].position.x + boxes[b].size.x
+                && boxes[b].position.x < boxes[a].position.x + boxes[a].size.x
+                && boxes[a].position.y < boxes[b].position.y + boxes[b].size.y
+                && boxes[b].position.y < boxes[a].position.y + boxes[a].size.y) {
+                expected.push_back({a, b});
+            }
+        }
+    }
+    const auto found = hash.pairs();
+    std::vector<Example::CollisionPair> actual(found.begin(), found.end());
+    const auto less = [](const Example::CollisionPair& x, const Example::CollisionPair& y) {
+        return x.a != y.a ? x.a < y.a : x.b < y.b;
+    };
+    std::sort(actual.begin(), actual.end(), less);
+    return actual.size() == expected.size()
+        && std::equal(actual.begin(), actual.end(), expected.begin(),
+                      [](const auto& x, const auto& y) { return x.a == y.a && x.b == y.b; });
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const auto count = static_cast<std::size_t>(Bench::argOr(argc, argv, 1, 50000));
+    const auto world = static_cast<float>(Bench::argOr(argc, argv, 2, 4000));
+    const int ticks = static_cast<int>(Bench::argOr(argc, argv, 3, 50));
+    const bool check = Bench::argOr(argc, argv, 4, 0) != 0;
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> position(0.f, world);
+    std::uniform_real_distribution<float> extent(4.f, 24.f);
+    std::uniform_real_distribution<float> jitter(-1.f, 1.f);
+
+    std::vector<sf::FloatRect> boxes(count);
+    for (sf::FloatRect& box : boxes) {
+        box = {{position(rng), position(rng)}, {extent(rng), extent(rng)}};
+    }
+
+    std::printf("%zu objects in %.0fx%.0f, best tick of %d\n", count, world, world, ticks);
+    for (const float cellSize : {16.f, 32.f, 48.f, 64.f}) {
+        Example::SpatialHash hash(cellSize);
+        hash.reserve(count);
+
+        double best = 1e30;
+        std::size_t pairCount = 0;
+        for (int tick = 0; tick < ticks; ++tick) {
+            for (sf::FloatRect& box : boxes) box.position += {jitter(rng), jitter(rng)};
+
+            const Bench::Clock::time_point start = Bench::Clock::now();
+            hash.clear();
+            hash.insertBounds(boxes);
+            pairCount = hash.pairs().size();
+            best = std::min(best, Bench::elapsedMs(start));
+        }
+
+        std::printf("  cell %3.0f: %7.3f ms  %8zu pairs%s\n", static_cast<double>(cellSize), best, pairCount,
+                    check ? (verify(hash, boxes) ? "  (matches brute force)" : "  MISMATCH") : "");
+    }
+    return 0;
+}
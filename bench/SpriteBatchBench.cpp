@@ -0,0 +1,80 @@
+// Unbatched vs batched sprite drawing on a synthetic scene.
+//
+// Each frame clears and draws `sprites` sprites cycling through `textures`
+// textures, then presents. Unbatched, every sprite goes through
+// Renderer::draw(); batched, they are submitted between beginBatch() and
+// endBatch(), which draws one call per texture. All sprites are inside the
+// view, so nothing is culled. Prints the draw-call count of the last frame
+// (Renderer::getDrawCallCount()) and the mean frame time of each mode.
+//
+// Usage: SpriteBatchBench [sprites=50000] [frames=100] [textures=4]
+// Renders offscreen (no window), but still needs an OpenGL context.
+
+#include "BenchCommon.hpp"
+#include "Engine/Graphics/Renderer.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+template <typename DrawFn>
+double runFrames(Engine::Renderer& renderer, long frames, DrawFn&& drawSprites) {
+    const Bench::Clock::time_point start = Bench::Clock::now();
+    for (long frame = 0; frame < frames; ++frame) {
+        renderer.clear();
+        drawSprites();
+        renderer.display();
+    }
+    return Bench::elapsedMs(start) / static_cast<double>(frames);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const long spriteCount = Bench::argOr(argc, argv, 1, 50000);
+    const long frames = std::max(Bench::argOr(argc, argv, 2, 100), 1L);
+    const long textureCount = std::max(Bench::argOr(argc, argv, 3, 4), 1L);
+
+    Engine::Renderer renderer(1280, 720, "SpriteBatchBench", Engine::RenderMode::Offscreen);
+
+    std::vector<sf::Texture> textures(static_cast<std::size_t>(textureCount));
+    for (long i = 0; i < textureCount; ++i) {
+        const sf::Image image({16, 16}, sf::Color(static_cast<std::uint8_t>(64 + i * 191 / textureCount), 128, 255));
+        if (!textures[static_cast<std::size_t>(i)].loadFromImage(image)) {
+            std::fprintf(stderr, "SpriteBatchBench: Failed to create texture\n");
+            return 1;
+        }
+    }
+
+    // Textures interleaved in submission order: the worst case for draw()
+    std::vector<sf::Sprite> sprites;
+    sprites.reserve(static_cast<std::size_t>(spriteCount));
+    for (long i = 0; i < spriteCount; ++i) {
+        sf::Sprite& sprite = sprites.emplace_back(textures[static_cast<std::size_t>(i % textureCount)]);
+        sprite.setPosition({static_cast<float>(i * 37 % 1264), static_cast<float>(i * 91 % 704)});
+    }
+
+    std::printf("%ld sprites, %ld textures, %ld frames\n", spriteCount, textureCount, frames);
+
+    const double unbatched = runFrames(renderer, frames, [&] {
+        for (const sf::Sprite& sprite : sprites) {
+            renderer.draw(sprite);
+        }
+    });
+    const std::size_t unbatchedCalls = renderer.getDrawCallCount();
+    std::printf("  draw():  %7zu draw calls  %8.3f ms/frame\n", unbatchedCalls, unbatched);
+
+    const double batched = runFrames(renderer, frames, [&] {
+        renderer.beginBatch();
+        for (const sf::Sprite& sprite : sprites) {
+            renderer.submit(sprite);
+        }
+        renderer.endBatch();
+    });
+    const std::size_t batchedCalls = renderer.getDrawCallCount();
+    std::printf("  batched: %7zu draw calls  %8.3f ms/frame  (%.2fx)\n", batchedCalls, batched,
+                unbatched / batched);
+    return 0;
+}
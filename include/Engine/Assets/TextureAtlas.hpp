@@ -0,0 +1,141 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine {
+
+/// Location of a packed image: the atlas page texture and the sub-rectangle
+/// inside it. Sprites drawn from the same page share a texture and batch together.
+struct AtlasRegion {
+    const sf::Texture* texture = nullptr; ///< The page texture holding the image.
+    std::size_t page = 0;                 ///< Index of that page.
+    sf::IntRect rect;                     ///< Pixel rectangle of the image on the page.
+};
+
+/// Summary of the last build(), for tuning the page size.
+/// Packing is deterministic, so the same inputs always produce the same report.
+struct AtlasReport {
+    std::size_t pageCount = 0;        ///< Number of pages created.
+    std::size_t imageCount = 0;       ///< Number of images packed.
+    std::uint64_t usedPixels = 0;     ///< Pixels covered by images (padding excluded).
+    std::uint64_t totalPixels = 0;    ///< pageCount * page area.
+    float occupancy = 0.f;            ///< usedPixels / totalPixels, in percent.
+    std::vector<float> pageOccupancy; ///< Occupancy per page, in percent.
+};
+
+/// Runtime texture atlas builder.
+///
+/// Collects images, then packs them into a few large page textures with a
+/// skyline bottom-left packer. Where TextureManager creates one GPU texture
+/// per image, the atlas lets sprites from many images share one texture,
+/// so they can be batched (see Renderer::submit / Renderer::enqueue).
+///
+/// Images are packed tallest first (ties broken by width, then id), which
+/// makes the layout independent of insertion order. Source images stay in
+/// memory so the atlas can be repacked when more images are added.
+///
+/// Usage:
+/// @code
+///   atlas.add("player", "assets/player.png");
+///   atlas.add("enemy",  "assets/enemy.png");
+///   atlas.build();
+///
+///   const auto& region = atlas.get("player");
+///   sf::Sprite sprite(*region.texture, region.rect);
+/// @endcode
+class TextureAtlas {
+public:
+    TextureAtlas() = default;
+
+    /// Create an atlas with a custom page size.
+    /// @param pageSize Size in pixels of every page texture.
+    /// @param padding  Empty pixels kept between images (avoids filtering bleed).
+    explicit TextureAtlas(sf::Vector2u pageSize, unsigned int padding = 1);
+
+    ~TextureAtlas() = default;
+
+    // Non-copyable, movable
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+    TextureAtlas(TextureAtlas&&) = default;
+    TextureAtlas& operator=(TextureAtlas&&) = default;
+
+    /// Load an image from a file and queue it for packing.
+    /// If the ID already exists, this call is ignored.
+    /// @throws std::runtime_error if the file cannot be loaded.
+    void add(const std::string& id, const std::filesystem::path& filename);
+
+    /// Queue an image already in memory for packing.
+    /// If the ID already exists, this call is ignored.
+    /// @throws std::runtime_error if the image is empty.
+    void add(const std::string& id, const sf::Image& image);
+
+    /// Pack every queued image and upload the pages to the GPU.
+    /// Images added after a build are included by calling build() again,
+    /// which repacks everything (previous regions become invalid).
+    /// @throws std::runtime_error if an image is larger than a page or a
+    ///         page texture cannot be created.
+    void build();
+
+    /// Retrieve the packed location of an image.
+    /// @throws std::runtime_error if the ID is unknown or build() has not run since it was added.
+    [[nodiscard]] const AtlasRegion& get(const std::string& id) const;
+
+    /// Check whether an image with the given ID has been packed.
+    [[nodiscard]] bool has(const std::string& id) const;
+
+    /// Get a page texture by index.
+    [[nodiscard]] const sf::Texture& getPage(std::size_t index) const;
+
+    /// Get the number of pages produced by the last build().
+    [[nodiscard]] std::size_t getPageCount() const;
+
+    /// Get the page size in pixels.
+    [[nodiscard]] sf::Vector2u getPageSize() const;
+
+    /// Get the packing report of the last build().
+    [[nodiscard]] const AtlasReport& getReport() const;
+
+    /// Remove all images and pages.
+    void clear();
+
+private:
+    /// One horizontal segment of a page's skyline.
+    struct SkylineNode {
+        unsigned int x;
+        unsigned int y;
+        unsigned int width;
+    };
+
+    /// Packing state of one page.
+    struct Page {
+        std::vector<SkylineNode> skyline;
+        sf::Image image;
+        std::uint64_t usedPixels = 0;
+    };
+
+    /// Try to place a w x h rectangle on a page (bottom-left heuristic).
+    /// @return True and the position on success.
+    bool insert(Page& page, sf::Vector2u size, sf::Vector2u& position) const;
+
+    /// Height at which a w x h rectangle would rest if placed at skyline node `index`,
+    /// or false if it does not fit there.
+    bool fit(const Page& page, std::size_t index, sf::Vector2u size, unsigned int& y) const;
+
+    sf::Vector2u m_pageSize{2048, 2048};
+    unsigned int m_padding = 1;
+
+    std::unordered_map<std::string, sf::Image> m_images;
+    std::unordered_map<std::string, AtlasRegion> m_regions;
+    std::vector<std::unique_ptr<sf::Texture>> m_pages;
+    AtlasReport m_report;
+};
+
+} // namespace Engine
@@ -1,11 +1,15 @@
 #pragma once
 
+#include "Engine/Core/FramePacer.hpp"
 #include "Engine/Graphics/Renderer.hpp"
+#include "Engine/Graphics/InterpolationBuffer.hpp"
 #include "Engine/Input/InputManager.hpp"
 #include "Engine/Audio/AudioManager.hpp"
 #include "Engine/Scene/SceneManager.hpp"
 #include "Engine/Event/EventBus.hpp"
 #include "Engine/Assets/AssetManager.hpp"
+#include "Engine/Assets/TextureAtlas.hpp"
+#include <cstddef>
 #include <string>
 #include <memory>
 
@@ -26,7 +30,11 @@ struct Context {
     AudioManager&   audio;
     SceneManager&   scenes;
     EventBus&       events;
+    FramePacer&     pacer;
+    const RenderStatsRecorder& renderStats;
+    InterpolationBuffer& interpolation;
     TextureManager  textures;
+    TextureAtlas    atlas;
     FontManager     fonts;
     SoundBufferManager sounds;
 };
@@ -45,13 +53,26 @@ struct Context {
 ///       std::make_unique<MyScene>(app.context()));
 ///   app.run();
 /// @endcode
+///
+/// For benchmarks and golden-image tests without a display, construct it
+/// with RenderMode::Offscreen and step a fixed number of frames:
+/// @code
+///   Engine::Application app(1280, 720, "Bench",
+///       {Engine::PresentMode::Uncapped}, Engine::RenderMode::Offscreen);
+///   app.context().scenes.pushScene(std::make_unique<MyScene>(app.context()));
+///   app.runFrames(600);
+///   auto hash = app.context().renderer.hashFrame();
+/// @endcode
 class Application {
 public:
     /// Construct the application with a window of the given size and title.
     /// @param width  Window width in pixels.
     /// @param height Window height in pixels.
     /// @param title  Window title.
-    Application(unsigned int width, unsigned int height, const std::string& title);
+    /// @param pacing Frame pacing mode (default: precise 60 FPS).
+    /// @param mode   Render to a window or offscreen (no window is opened).
+    Application(unsigned int width, unsigned int height, const std::string& title,
+                FramePacing pacing = {}, RenderMode mode = RenderMode::Windowed);
     ~Application() = default;
 
     // Non-copyable, non-movable
@@ -64,20 +85,40 @@ public:
     /// or the scene stack becomes empty.
     void run();
 
+    /// Run exactly `frameCount` frames (fewer if the renderer closes or the
+    /// scene stack empties). Each frame advances one fixed timestep
+    /// regardless of wall-clock time, so runs are reproducible.
+    /// @return The number of frames actually run.
+    std::size_t runFrames(std::size_t frameCount);
+
+    /// Change the frame pacing mode at runtime (also available via Context::pacer).
+    void setFramePacing(FramePacing pacing);
+
+    /// Get frame-time mean/variance over the recent frames.
+    [[nodiscard]] FrameTimeStats getFrameTimeStats() const;
+
     /// Get the shared context (all engine subsystems).
     [[nodiscard]] Context& context();
     [[nodiscard]] const Context& context() const;
 
 private:
+    /// Run one frame: scene changes, input, fixed updates, draw, pacing.
+    /// @param accumulator Unsimulated time; consumed in fixed steps.
+    void step(float& accumulator);
+
     static constexpr float dt = 1.0f / 60.0f; ///< Fixed timestep (60 Hz)
     sf::Clock m_clock;
 
-    // Owned subsystems
+    // Owned subsystems. The EventBus and InterpolationBuffer are declared
+    // before the SceneManager so they outlive the scenes: waiting behaviours
+    // unsubscribe and scenes release their interpolation slots when destroyed.
     Renderer     m_renderer;
     InputManager m_input;
     AudioManager m_audio;
-    SceneManager m_scenes;
     EventBus     m_events;
+    InterpolationBuffer m_interpolation;
+    SceneManager m_scenes;
+    FramePacer   m_pacer;
 
     // Context binds references to owned subsystems
     Context m_context;
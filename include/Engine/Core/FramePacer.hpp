@@ -0,0 +1,104 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+namespace Engine {
+
+class Renderer;
+
+/// How frames are paced and presented.
+enum class PresentMode {
+    VSync,    ///< Let the driver block on vertical sync.
+    Uncapped, ///< Render as fast as possible.
+    Precise   ///< Hit a target rate: coarse sleep, then spin-wait to the deadline.
+};
+
+/// Frame pacing configuration.
+struct FramePacing {
+    PresentMode mode = PresentMode::Precise;
+    unsigned int targetRate = 60; ///< Frames per second (Precise mode only).
+};
+
+/// Frame-time statistics over the pacer's rolling window, in seconds.
+struct FrameTimeStats {
+    float mean = 0.f;
+    float variance = 0.f;
+    float standardDeviation = 0.f;
+    float min = 0.f;
+    float max = 0.f;
+    std::size_t samples = 0;
+};
+
+/// Paces the main loop and measures frame-time stability.
+///
+/// sf::Window::setFramerateLimit() relies on a single coarse sf::sleep,
+/// whose granularity (often 1-2 ms, sometimes more) shows up as jitter.
+/// In Precise mode the pacer sleeps until shortly before the deadline and
+/// spin-waits the remainder against a steady clock. Deadlines advance by
+/// a fixed period, so small overshoots do not accumulate as drift.
+///
+/// Usage:
+/// @code
+///   FramePacer pacer(renderer, {PresentMode::Precise, 144});
+///   // Each frame, after renderer.display():
+///   pacer.wait();
+/// @endcode
+class FramePacer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Number of frames kept for statistics.
+    static constexpr std::size_t HistorySize = 240;
+
+    /// Create a pacer and configure the renderer for the given mode.
+    /// @param renderer Renderer whose vsync / framerate limit is managed.
+    /// @param pacing   Initial pacing configuration.
+    explicit FramePacer(Renderer& renderer, FramePacing pacing = {});
+    ~FramePacer() = default;
+
+    // Non-copyable, non-movable (bound to a renderer)
+    FramePacer(const FramePacer&) = delete;
+    FramePacer& operator=(const FramePacer&) = delete;
+    FramePacer(FramePacer&&) = delete;
+    FramePacer& operator=(FramePacer&&) = delete;
+
+    /// Change the pacing at runtime. The renderer is reconfigured immediately.
+    void setPacing(FramePacing pacing);
+
+    /// Get the current pacing configuration.
+    [[nodiscard]] const FramePacing& getPacing() const;
+
+    /// Block until the next frame should start, then record the frame time.
+    /// Call once per frame, after presenting.
+    void wait();
+
+    /// Get mean, variance and extremes of the recent frame times.
+    [[nodiscard]] FrameTimeStats getStats() const;
+
+    /// Set how long before a deadline sleeping stops and spinning starts.
+    /// Larger values are more precise but burn more CPU. Default is 2 ms.
+    void setSpinThreshold(std::chrono::microseconds threshold);
+
+private:
+    /// Configure vsync for the current mode. SFML's own limiter is always
+    /// disabled; pacing is done by wait().
+    void apply();
+
+    void record(Clock::time_point now);
+
+    Renderer& m_renderer;
+    FramePacing m_pacing;
+    std::chrono::microseconds m_spinThreshold{2000};
+
+    Clock::time_point m_deadline;
+    Clock::time_point m_lastFrame;
+    bool m_started = false;
+
+    std::array<float, HistorySize> m_history{};
+    std::size_t m_historyNext = 0;
+    std::size_t m_historyCount = 0;
+};
+
+} // namespace Engine
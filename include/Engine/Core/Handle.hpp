@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+
+namespace Engine {
+
+/// Generational handle: a slot index plus the generation the slot had
+/// when the handle was issued.
+///
+/// Slots are recycled; every recycle bumps the slot's generation, so a
+/// handle kept past its object's destruction no longer matches and is
+/// detected as stale instead of silently referring to the slot's new
+/// occupant. The Tag parameter only makes handles of different pools
+/// distinct types.
+template <typename Tag>
+struct Handle {
+    static constexpr std::uint32_t InvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t index = InvalidIndex;
+    std::uint32_t generation = 0;
+
+    /// Check whether this is the default (null) handle. A non-null handle
+    /// may still be stale; ask the issuing pool with isValid().
+    [[nodiscard]] constexpr bool isNull() const {
+        return index == InvalidIndex;
+    }
+
+    friend constexpr bool operator==(Handle a, Handle b) {
+        return a.index == b.index && a.generation == b.generation;
+    }
+
+    friend constexpr bool operator!=(Handle a, Handle b) {
+        return !(a == b);
+    }
+};
+
+} // namespace Engine
+
+/// Hash support so handles can key unordered containers.
+template <typename Tag>
+struct std::hash<Engine::Handle<Tag>> {
+    std::size_t operator()(Engine::Handle<Tag> handle) const noexcept {
+        return std::hash<std::uint64_t>{}(
+            (static_cast<std::uint64_t>(handle.generation) << 32) | handle.index);
+    }
+};
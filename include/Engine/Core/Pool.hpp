@@ -0,0 +1,159 @@
+#pragma once
+
+#include "Engine/Core/Handle.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Engine {
+
+/// Object pool with generational handles and always-compact storage.
+///
+/// Live objects are kept packed in one contiguous array, so iterating the
+/// pool touches only live objects. A slot table maps a handle to the
+/// object's current position; destroying an object moves the last object
+/// into its place and puts the slot on a free list, where the next
+/// create() picks it up with a bumped generation. Stale handles are
+/// therefore rejected by isValid() / get().
+///
+/// Once reserve() has sized the pool for its peak population, create()
+/// and destroy() never allocate: spawning and despawning bullets every
+/// frame does not touch the general-purpose heap.
+///
+/// Usage:
+/// @code
+///   Engine::Pool<Bullet> bullets;
+///   bullets.reserve(10000);
+///   auto handle = bullets.create(position, velocity);
+///   for (Bullet& b : bullets) b.update(dt);   // live bullets only
+///   bullets.destroy(handle);
+///   bullets.get(handle); // nullptr: the handle is stale
+/// @endcode
+///
+/// Pointers and references to objects are invalidated by destroy()
+/// (objects move) and by a create() that grows the pool; keep handles.
+template <typename T>
+class Pool {
+public:
+    using Handle = Engine::Handle<T>;
+
+    Pool() = default;
+    ~Pool() = default;
+
+    // Non-copyable, movable
+    Pool(const Pool&) = delete;
+    Pool& operator=(const Pool&) = delete;
+    Pool(Pool&&) = default;
+    Pool& operator=(Pool&&) = default;
+
+    /// Pre-allocate room for `capacity` live objects.
+    void reserve(std::size_t capacity) {
+        m_objects.reserve(capacity);
+        m_owners.reserve(capacity);
+        m_slots.reserve(capacity);
+    }
+
+    /// Construct an object in the pool.
+    /// @return A handle that stays valid until destroy().
+    template <typename... Args>
+    Handle create(Args&&... args) {
+        std::uint32_t slot;
+        if (m_freeHead != Npos) {
+            slot = m_freeHead;
+            m_freeHead = m_slots[slot].dense; // Free slots chain through `dense`
+        } else {
+            slot = static_cast<std::uint32_t>(m_slots.size());
+            m_slots.push_back({});
+        }
+
+        m_slots[slot].dense = static_cast<std::uint32_t>(m_objects.size());
+        m_slots[slot].live = true;
+        m_objects.emplace_back(std::forward<Args>(args)...);
+        m_owners.push_back(slot);
+        return Handle{slot, m_slots[slot].generation};
+    }
+
+    /// Destroy an object. Stale or null handles are ignored.
+    /// @return True if an object was destroyed.
+    bool destroy(Handle handle) {
+        if (!isValid(handle)) return false;
+
+        Slot& slot = m_slots[handle.index];
+        const std::uint32_t last = static_cast<std::uint32_t>(m_objects.size() - 1);
+
+        // Keep storage compact: move the last object into the hole
+        if (slot.dense != last) {
+            m_objects[slot.dense] = std::move(m_objects[last]);
+            m_owners[slot.dense] = m_owners[last];
+            m_slots[m_owners[slot.dense]].dense = slot.dense;
+        }
+        m_objects.pop_back();
+        m_owners.pop_back();
+
+        ++slot.generation;
+        slot.dense = m_freeHead;
+        slot.live = false;
+        m_freeHead = handle.index;
+        return true;
+    }
+
+    /// Check whether the handle refers to a live object.
+    [[nodiscard]] bool isValid(Handle handle) const {
+        return handle.index < m_slots.size()
+            && m_slots[handle.index].live
+            && m_slots[handle.index].generation == handle.generation;
+    }
+
+    /// Get the object, or nullptr if the handle is null or stale.
+    [[nodiscard]] T* get(Handle handle) {
+        return isValid(handle) ? &m_objects[m_slots[handle.index].dense] : nullptr;
+    }
+
+    [[nodiscard]] const T* get(Handle handle) const {
+        return isValid(handle) ? &m_objects[m_slots[handle.index].dense] : nullptr;
+    }
+
+    /// Get the handle of the object at a position in the live array
+    /// (e.g. to destroy objects found while iterating).
+    [[nodiscard]] Handle handleAt(std::size_t position) const {
+        const std::uint32_t slot = m_owners[position];
+        return Handle{slot, m_slots[slot].generation};
+    }
+
+    /// Destroy every object. All outstanding handles become stale.
+    void clear() {
+        while (!m_objects.empty()) {
+            destroy(handleAt(m_objects.size() - 1));
+        }
+    }
+
+    /// Get the number of live objects.
+    [[nodiscard]] std::size_t size() const { return m_objects.size(); }
+    [[nodiscard]] bool empty() const { return m_objects.empty(); }
+
+    /// Get the number of objects the pool holds without allocating.
+    [[nodiscard]] std::size_t capacity() const { return m_objects.capacity(); }
+
+    // Iteration over live objects only (contiguous)
+    [[nodiscard]] T* begin() { return m_objects.data(); }
+    [[nodiscard]] T* end() { return m_objects.data() + m_objects.size(); }
+    [[nodiscard]] const T* begin() const { return m_objects.data(); }
+    [[nodiscard]] const T* end() const { return m_objects.data() + m_objects.size(); }
+
+private:
+    static constexpr std::uint32_t Npos = Handle::InvalidIndex;
+
+    struct Slot {
+        std::uint32_t dense = Npos;   ///< Live: position in m_objects. Free: next free slot.
+        std::uint32_t generation = 0;
+        bool live = true;
+    };
+
+    std::vector<T> m_objects;            ///< Live objects, packed.
+    std::vector<std::uint32_t> m_owners; ///< Position in m_objects -> slot.
+    std::vector<Slot> m_slots;           ///< Handle index -> slot.
+    std::uint32_t m_freeHead = Npos;     ///< First free slot (intrusive list).
+};
+
+} // namespace Engine
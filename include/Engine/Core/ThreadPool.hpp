@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Engine {
+
+/// Fixed set of worker threads for data-parallel loops.
+///
+/// parallelFor() hands out indices one at a time from a shared counter,
+/// so uneven items (e.g. physics islands of different sizes) balance on
+/// their own. The calling thread works too and the call blocks until
+/// every index is done, so the pool fits naturally inside a fixed update:
+/// no futures, no task graph, nothing outlives the call.
+///
+/// Which thread runs which index is unspecified. Code that must be
+/// deterministic should make each index's work independent of the others
+/// and write to disjoint data.
+///
+/// Usage:
+/// @code
+///   Engine::ThreadPool pool;                // hardware_concurrency() threads
+///   pool.parallelFor(islands.size(), [&](std::size_t i) {
+///       solve(islands[i]);
+///   });
+/// @endcode
+///
+/// Thread safety: parallelFor() must not be called concurrently or from
+/// inside a task.
+class ThreadPool {
+public:
+    /// @param threadCount Threads taking part in parallelFor(), including
+    ///                    the caller (0 = one per hardware thread). 1 runs
+    ///                    everything on the caller.
+    explicit ThreadPool(unsigned int threadCount = 0);
+
+    /// Stop and join the workers.
+    ~ThreadPool();
+
+    // Non-copyable, non-movable (owns running threads)
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    /// Call task(i) for every i in [0, count) across the threads and wait.
+    /// If a task throws, the remaining indices are skipped and the first
+    /// exception is rethrown here.
+    void parallelFor(std::size_t count, const std::function<void(std::size_t)>& task);
+
+    /// Get the number of threads taking part (workers + caller).
+    [[nodiscard]] unsigned int getThreadCount() const;
+
+private:
+    void workerLoop();
+    void runTasks();
+
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;  ///< Workers: a new loop started or stopping.
+    std::condition_variable m_done;  ///< Caller: the last worker finished.
+    std::uint64_t m_generation = 0;  ///< Bumped per parallelFor().
+    unsigned int m_active = 0;       ///< Workers still inside the current loop.
+    bool m_stop = false;
+
+    const std::function<void(std::size_t)>* m_task = nullptr;
+    std::size_t m_count = 0;
+    std::atomic<std::size_t> m_next{0};
+    std::exception_ptr m_error;      ///< First exception thrown by a task.
+};
+
+} // namespace Engine
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "Engine/Core/Handle.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Engine {
+
+/// Tag type for entity handles.
+struct EntityTag {};
+
+/// Identifier of an entity in a Registry: slot index + generation, so an
+/// id kept after its entity was destroyed is detected as stale.
+using EntityId = Handle<EntityTag>;
+
+/// An id that never refers to an entity.
+inline constexpr EntityId NullEntity{};
+
+/// Type-erased interface so the Registry can remove an entity's
+/// components without knowing their types.
+class IComponentPool {
+public:
+    virtual ~IComponentPool() = default;
+
+    /// Remove the entity's component, if it has one.
+    virtual void remove(EntityId entity) = 0;
+
+    /// Check whether the entity has a component in this pool.
+    [[nodiscard]] virtual bool contains(EntityId entity) const = 0;
+
+    /// Get the number of components stored.
+    [[nodiscard]] virtual std::size_t size() const = 0;
+
+    /// Get the owning entities, in the same order as the components.
+    [[nodiscard]] virtual const EntityId* entities() const = 0;
+
+    /// Remove every component.
+    virtual void clear() = 0;
+};
+
+/// Sparse-set storage for one component type.
+///
+/// Components live in one contiguous array ("dense"), next to a parallel
+/// array of their entity ids, so iterating a component type is a linear
+/// walk over memory. A sparse array maps an entity id to its dense slot
+/// for O(1) lookup, insertion and removal. The sparse array is indexed by
+/// the id's slot index; lookups compare the full id (with generation), so
+/// a stale id never finds the component of the slot's next occupant. Removal swaps the last element
+/// into the hole, so the dense arrays never contain gaps but their order
+/// changes.
+///
+/// References and pointers returned by get() or data() are invalidated by
+/// any emplace() or remove() on the same pool.
+template <typename Component>
+class ComponentPool final : public IComponentPool {
+public:
+    /// Sparse entry for "no component".
+    static constexpr std::uint32_t Npos = std::numeric_limits<std::uint32_t>::max();
+
+    /// Add or replace the entity's component, constructed from args.
+    template <typename... Args>
+    Component& emplace(EntityId entity, Args&&... args) {
+        if (entity.index >= m_sparse.size()) {
+            m_sparse.resize(static_cast<std::size_t>(entity.index) + 1, Npos);
+        }
+
+        std::uint32_t& slot = m_sparse[entity.index];
+        if (slot != Npos && m_entities[slot] == entity) {
+            m_components[slot] = Component{std::forward<Args>(args)...};
+            return m_components[slot];
+        }
+
+        if (slot != Npos) {
+            remove(m_entities[slot]); // Left behind by a stale id of this slot
+        }
+
+        slot = static_cast<std::uint32_t>(m_components.size());
+        m_entities.push_back(entity);
+        m_components.push_back(Component{std::forward<Args>(args)...});
+        return m_components.back();
+    }
+
+    void remove(EntityId entity) override {
+        if (!contains(entity)) return;
+
+        const std::uint32_t slot = m_sparse[entity.index];
+        const std::uint32_t last = static_cast<std::uint32_t>(m_components.size() - 1);
+
+        if (slot != last) {
+            m_components[slot] = std::move(m_components[last]);
+            m_entities[slot] = m_entities[last];
+            m_sparse[m_entities[slot].index] = slot;
+        }
+
+        m_components.pop_back();
+        m_entities.pop_back();
+        m_sparse[entity.index] = Npos;
+    }
+
+    [[nodiscard]] bool contains(EntityId entity) const override {
+        return entity.index < m_sparse.size()
+            && m_sparse[entity.index] != Npos
+            && m_entities[m_sparse[entity.index]] == entity;
+    }
+
+    /// Get the entity's component. The entity must have one.
+    [[nodiscard]] Component& get(EntityId entity) {
+        return m_components[m_sparse[entity.index]];
+    }
+
+    [[nodiscard]] const Component& get(EntityId entity) const {
+        return m_components[m_sparse[entity.index]];
+    }
+
+    /// Get the entity's component, or nullptr if it has none.
+    [[nodiscard]] Component* tryGet(EntityId entity) {
+        return contains(entity) ? &m_components[m_sparse[entity.index]] : nullptr;
+    }
+
+    [[nodiscard]] const Component* tryGet(EntityId entity) const {
+        return contains(entity) ? &m_components[m_sparse[entity.index]] : nullptr;
+    }
+
+    /// Get the dense slot of the entity's component. The entity must have one.
+    [[nodiscard]] std::size_t indexOf(EntityId entity) const {
+        return m_sparse[entity.index];
+    }
+
+    [[nodiscard]] std::size_t size() const override {
+        return m_components.size();
+    }
+
+    [[nodiscard]] const EntityId* entities() const override {
+        return m_entities.data();
+    }
+
+    /// Get the contiguous component array (size() elements).
+    [[nodiscard]] Component* data() {
+        return m_components.data();
+    }
+
+    [[nodiscard]] const Component* data() const {
+        return m_components.data();
+    }
+
+    /// Exchange two dense slots (component and owner), keeping lookups valid.
+    void swapSlots(std::size_t a, std::size_t b) {
+        if (a == b) return;
+        std::swap(m_components[a], m_components[b]);
+        std::swap(m_entities[a], m_entities[b]);
+        m_sparse[m_entities[a].index] = static_cast<std::uint32_t>(a);
+        m_sparse[m_entities[b].index] = static_cast<std::uint32_t>(b);
+    }
+
+    /// Reserve room for the given number of components.
+    void reserve(std::size_t capacity) {
+        m_components.reserve(capacity);
+        m_entities.reserve(capacity);
+    }
+
+    void clear() override {
+        m_components.clear();
+        m_entities.clear();
+        m_sparse.clear();
+    }
+
+private:
+    std::vector<std::uint32_t> m_sparse; ///< Entity id -> dense slot (Npos if absent).
+    std::vector<EntityId> m_entities;    ///< Dense slot -> entity id.
+    std::vector<Component> m_components; ///< Dense component data.
+};
+
+} // namespace Engine
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <SFML/System.hpp>
+
+namespace Engine {
+
+/// World position (top-left of the entity's bounds), in pixels.
+struct Position {
+    sf::Vector2f value{0.f, 0.f};
+};
+
+/// Linear velocity, in pixels per second.
+struct Velocity {
+    sf::Vector2f value{0.f, 0.f};
+};
+
+/// Bounding box size, in pixels.
+struct Size {
+    sf::Vector2f value{0.f, 0.f};
+};
+
+} // namespace Engine
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Engine/ECS/Registry.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <optional>
+
+namespace Engine {
+
+/// Instruction set used by the bulk integration kernel.
+enum class SimdLevel {
+    Scalar, ///< Plain C++ loop (any CPU).
+    SSE2,   ///< 4 floats (2 entities) per step; baseline on x86-64.
+    AVX     ///< 8 floats (4 entities) per step.
+};
+
+/// Optional behaviour of integrate().
+struct IntegrationParams {
+    float damping = 0.f;   ///< Linear velocity damping per second (0 = none).
+    float maxSpeed = 0.f;  ///< Per-axis velocity clamp in pixels/s (0 = unclamped).
+    std::optional<sf::FloatRect> bounds; ///< Clamp positions into this rectangle.
+};
+
+/// Get the widest instruction set the running CPU supports
+/// (detected once, then cached).
+[[nodiscard]] SimdLevel detectSimdLevel();
+
+/// Semi-implicit Euler step over interleaved (x, y) arrays:
+/// velocity is damped and clamped first, then position += velocity * dt
+/// and position is clamped.
+///
+/// Every path performs the same float operations in the same order (no
+/// FMA), and the scalar clamps follow the SSE min/max rules (a NaN is
+/// clamped to the lower bound; of two equal zeros the bound is kept), so
+/// scalar and SIMD results are bit-identical and a simulation stays
+/// deterministic regardless of the CPU it runs on, as long as the build
+/// does not contract the scalar loop into FMA instructions.
+///
+/// @param positions  2 * count floats (x0, y0, x1, y1, ...), updated in place.
+/// @param velocities 2 * count floats, updated in place (damping / clamping).
+/// @param count      Number of entities.
+/// @param dt         Time step in seconds.
+/// @param params     Damping and clamping (defaults: none).
+/// @param level      Force an instruction set (lowered to what the CPU supports).
+void integrate(float* positions, float* velocities, std::size_t count, float dt,
+               const IntegrationParams& params, SimdLevel level);
+
+/// Same as above, using the widest instruction set available.
+void integrate(float* positions, float* velocities, std::size_t count, float dt,
+               const IntegrationParams& params = {});
+
+/// Integrate every entity having both a Position and a Velocity.
+///
+/// Groups the two pools (see Registry::group()) so the kernel can run over
+/// their dense arrays in lockstep, then calls integrate() once.
+/// @return The number of entities integrated.
+std::size_t integrate(Registry& registry, float dt, const IntegrationParams& params = {});
+
+} // namespace Engine
@@ -0,0 +1,274 @@
+#pragma once
+
+#include "Engine/ECS/ComponentPool.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Engine {
+
+namespace detail {
+
+/// Hand out the next dense component type index (defined in Registry.cpp).
+std::size_t nextComponentTypeIndex();
+
+/// Dense index of a component type, assigned on first use.
+template <typename Component>
+std::size_t componentTypeIndex() {
+    static const std::size_t index = nextComponentTypeIndex();
+    return index;
+}
+
+} // namespace detail
+
+/// Iterates every entity that has all of the given components.
+///
+/// The smallest of the pools drives the iteration; the others are probed
+/// through their sparse arrays. A single-component view walks the dense
+/// array directly. Obtain views from Registry::view().
+///
+/// Adding or removing components of the viewed types (or destroying
+/// entities) inside each() is not allowed; collect the ids and apply the
+/// changes after the loop.
+template <typename... Components>
+class View {
+public:
+    explicit View(ComponentPool<Components>&... pools)
+        : m_pools(&pools...) {}
+
+    /// Call fn for every matching entity. fn takes either
+    /// (EntityId, Components&...) or (Components&...).
+    template <typename Fn>
+    void each(Fn&& fn) {
+        if constexpr (sizeof...(Components) == 1) {
+            auto& pool = *std::get<0>(m_pools);
+            const EntityId* ids = pool.entities();
+            auto* components = pool.data();
+            for (std::size_t i = 0, n = pool.size(); i < n; ++i) {
+                invoke(fn, ids[i], components[i]);
+            }
+        } else {
+            const IComponentPool* driver = smallest();
+            const EntityId* ids = driver->entities();
+            for (std::size_t i = 0, n = driver->size(); i < n; ++i) {
+                const EntityId entity = ids[i];
+                if ((std::get<ComponentPool<Components>*>(m_pools)->contains(entity) && ...)) {
+                    invoke(fn, entity, std::get<ComponentPool<Components>*>(m_pools)->get(entity)...);
+                }
+            }
+        }
+    }
+
+    /// Upper bound on the number of matching entities (size of the smallest pool).
+    [[nodiscard]] std::size_t sizeHint() const {
+        return smallest()->size();
+    }
+
+private:
+    [[nodiscard]] const IComponentPool* smallest() const {
+        const IComponentPool* result = std::get<0>(m_pools);
+        ((result = std::get<ComponentPool<Components>*>(m_pools)->size() < result->size()
+              ? std::get<ComponentPool<Components>*>(m_pools) : result), ...);
+        return result;
+    }
+
+    template <typename Fn, typename... Refs>
+    static void invoke(Fn& fn, EntityId entity, Refs&... components) {
+        if constexpr (std::is_invocable_v<Fn&, EntityId, Refs&...>) {
+            fn(entity, components...);
+        } else {
+            fn(components...);
+        }
+    }
+
+    std::tuple<ComponentPool<Components>*...> m_pools;
+};
+
+/// Entity registry with structure-of-arrays component storage.
+///
+/// An entity is just an id. Each component type is kept in its own
+/// ComponentPool (a sparse set), so the data a system touches is packed
+/// contiguously instead of spread across heap objects, and systems are
+/// plain loops instead of virtual calls. Any copyable or movable struct
+/// can be a component; pools are created on first use.
+///
+/// Usage:
+/// @code
+///   Engine::Registry registry;
+///   auto id = registry.create();
+///   registry.emplace<Engine::Position>(id, sf::Vector2f{100.f, 50.f});
+///   registry.emplace<Engine::Velocity>(id, sf::Vector2f{20.f, 0.f});
+///
+///   registry.view<Engine::Position, Engine::Velocity>().each(
+///       [dt](Engine::Position& p, const Engine::Velocity& v) {
+///           p.value += v.value * dt;
+///       });
+/// @endcode
+///
+/// Thread safety: NOT thread-safe. All calls must happen on the same thread.
+class Registry {
+public:
+    Registry() = default;
+    ~Registry() = default;
+
+    // Non-copyable, movable
+    Registry(const Registry&) = delete;
+    Registry& operator=(const Registry&) = delete;
+    Registry(Registry&&) = default;
+    Registry& operator=(Registry&&) = default;
+
+    /// Create an entity with no components. Slots of destroyed entities are
+    /// reused (with a new generation) before new ones are allocated.
+    EntityId create();
+
+    /// Destroy an entity and all of its components. Stale ids are ignored.
+    void destroy(EntityId entity);
+
+    /// Check whether the id refers to a live entity (false for stale ids).
+    [[nodiscard]] bool isValid(EntityId entity) const;
+
+    /// Pre-allocate entity slots so create() does not allocate up to
+    /// `capacity` live entities (component pools reserve separately).
+    void reserve(std::size_t capacity);
+
+    /// Get the number of live entities.
+    [[nodiscard]] std::size_t size() const;
+
+    /// Destroy every entity. Pools keep their capacity.
+    void clear();
+
+    /// Add (or replace) a component on an entity.
+    /// @throws std::runtime_error if the entity is not valid.
+    template <typename Component, typename... Args>
+    Component& emplace(EntityId entity, Args&&... args) {
+        if (!isValid(entity)) {
+            throw std::runtime_error(
+                "Registry: Invalid entity -> " + std::to_string(entity.index)
+                + ":" + std::to_string(entity.generation));
+        }
+        return storage<Component>().emplace(entity, std::forward<Args>(args)...);
+    }
+
+    /// Remove a component from an entity, if present.
+    template <typename Component>
+    void remove(EntityId entity) {
+        if (auto* pool = findStorage<Component>()) {
+            pool->remove(entity);
+        }
+    }
+
+    /// Get a component. The entity must have it (see has() / tryGet()).
+    template <typename Component>
+    [[nodiscard]] Component& get(EntityId entity) {
+        return storage<Component>().get(entity);
+    }
+
+    /// @throws std::runtime_error if no entity ever had this component type
+    ///         (const access cannot create the pool).
+    template <typename Component>
+    [[nodiscard]] const Component& get(EntityId entity) const {
+        const auto* pool = findStorage<Component>();
+        if (!pool) {
+            throw std::runtime_error(
+                "Registry: No pool for component -> " + std::to_string(entity.index)
+                + ":" + std::to_string(entity.generation));
+        }
+        return pool->get(entity);
+    }
+
+    /// Get a component, or nullptr if the entity does not have it.
+    template <typename Component>
+    [[nodiscard]] Component* tryGet(EntityId entity) {
+        auto* pool = findStorage<Component>();
+        return pool ? pool->tryGet(entity) : nullptr;
+    }
+
+    template <typename Component>
+    [[nodiscard]] const Component* tryGet(EntityId entity) const {
+        const auto* pool = findStorage<Component>();
+        return pool ? pool->tryGet(entity) : nullptr;
+    }
+
+    /// Check whether the entity has a component.
+    template <typename Component>
+    [[nodiscard]] bool has(EntityId entity) const {
+        const auto* pool = findStorage<Component>();
+        return pool && pool->contains(entity);
+    }
+
+    /// Get the pool of a component type, creating it if needed.
+    template <typename Component>
+    [[nodiscard]] ComponentPool<Component>& storage() {
+        const std::size_t index = detail::componentTypeIndex<Component>();
+        if (index >= m_pools.size()) {
+            m_pools.resize(index + 1);
+        }
+        if (!m_pools[index]) {
+            m_pools[index] = std::make_unique<ComponentPool<Component>>();
+        }
+        return static_cast<ComponentPool<Component>&>(*m_pools[index]);
+    }
+
+    /// Get a view over every entity having all of the given components.
+    template <typename... Components>
+    [[nodiscard]] View<Components...> view() {
+        static_assert(sizeof...(Components) > 0, "Registry: A view needs at least one component");
+        return View<Components...>(storage<Components>()...);
+    }
+
+    /// Reorder two pools so the entities having both components come first,
+    /// in the same order in both. Afterwards element i of
+    /// storage<A>().data() and storage<B>().data() belong to the same
+    /// entity for every i below the returned count, so a system can run
+    /// over both arrays in lockstep. O(n); an already grouped pair is not
+    /// reshuffled. Any emplace()/remove() on either pool breaks the grouping.
+    /// @return The number of entities having both components.
+    template <typename A, typename B>
+    std::size_t group() {
+        static_assert(!std::is_same_v<A, B>, "Registry: Cannot group a component with itself");
+        auto& first = storage<A>();
+        auto& second = storage<B>();
+
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < first.size(); ++i) {
+            const EntityId entity = first.entities()[i];
+            if (!second.contains(entity)) continue;
+
+            first.swapSlots(i, count);
+            second.swapSlots(second.indexOf(entity), count);
+            ++count;
+        }
+        return count;
+    }
+
+private:
+    template <typename Component>
+    [[nodiscard]] ComponentPool<Component>* findStorage() const {
+        const std::size_t index = detail::componentTypeIndex<Component>();
+        if (index >= m_pools.size() || !m_pools[index]) {
+            return nullptr;
+        }
+        return static_cast<ComponentPool<Component>*>(m_pools[index].get());
+    }
+
+    /// Per entity slot: current generation and liveness. Free slots chain
+    /// through `nextFree`, so recycling never allocates.
+    struct Slot {
+        std::uint32_t generation = 0;
+        std::uint32_t nextFree = EntityId::InvalidIndex;
+        bool live = false;
+    };
+
+    std::vector<std::unique_ptr<IComponentPool>> m_pools; ///< Indexed by component type index.
+    std::vector<Slot> m_slots;                            ///< Indexed by EntityId::index.
+    std::uint32_t m_freeHead = EntityId::InvalidIndex;
+    std::size_t m_aliveCount = 0;
+};
+
+} // namespace Engine
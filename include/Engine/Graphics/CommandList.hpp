@@ -0,0 +1,89 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <variant>
+#include <vector>
+
+namespace Engine {
+
+/// Self-contained recording of one frame's draw commands.
+///
+/// Mirrors the drawing half of sf::RenderTarget (clear, setView, draw),
+/// but instead of issuing OpenGL calls it copies everything it needs, so
+/// the recording can be replayed later on another thread while the
+/// recorder moves on to the next frame.
+///
+/// What is copied:
+/// - raw vertices and sf::VertexArray contents,
+/// - sf::Sprite, sf::Text, sf::CircleShape, sf::RectangleShape and sf::ConvexShape.
+///
+/// What is referenced: textures, fonts, shaders and sf::VertexBuffer
+/// objects (GPU resources). They must outlive the replay and must not be
+/// modified while a frame is in flight (see Renderer::runOnRenderThread()).
+class CommandList {
+public:
+    CommandList() = default;
+    ~CommandList() = default;
+
+    // Non-copyable, movable
+    CommandList(const CommandList&) = delete;
+    CommandList& operator=(const CommandList&) = delete;
+    CommandList(CommandList&&) = default;
+    CommandList& operator=(CommandList&&) = default;
+
+    /// Record a clear of the target.
+    void clear(sf::Color color = sf::Color::Black);
+
+    /// Record a view change.
+    void setView(const sf::View& view);
+
+    /// Record a drawable by copying it.
+    /// @throws std::runtime_error if the drawable is not one of the copyable
+    ///         types listed in the class documentation.
+    void draw(const sf::Drawable& drawable, const sf::RenderStates& states = sf::RenderStates::Default);
+
+    /// Record raw vertices (copied).
+    void draw(const sf::Vertex* vertices, std::size_t vertexCount,
+              sf::PrimitiveType type, const sf::RenderStates& states = sf::RenderStates::Default);
+
+    /// Record a range of a vertex buffer (referenced).
+    void draw(const sf::VertexBuffer& buffer, std::size_t firstVertex, std::size_t vertexCount,
+              const sf::RenderStates& states = sf::RenderStates::Default);
+
+    /// Issue every recorded command, in order, to a real target.
+    void replay(sf::RenderTarget& target) const;
+
+    /// Drop all commands. Storage capacity is kept for the next frame.
+    void reset();
+
+    /// Check whether nothing has been recorded.
+    [[nodiscard]] bool empty() const;
+
+    /// Get the number of recorded commands.
+    [[nodiscard]] std::size_t size() const;
+
+private:
+    using Object = std::variant<sf::Sprite, sf::Text, sf::CircleShape,
+                                sf::RectangleShape, sf::ConvexShape>;
+
+    enum class Kind { Clear, SetView, Vertices, Buffer, Object };
+
+    /// One command; `index`/`count` point into the pool matching `kind`.
+    struct Command {
+        Kind kind = Kind::Clear;
+        sf::RenderStates states;
+        std::size_t index = 0;
+        std::size_t count = 0;
+        sf::PrimitiveType primitive = sf::PrimitiveType::Triangles;
+        sf::Color color;
+        const sf::VertexBuffer* buffer = nullptr;
+    };
+
+    std::vector<Command> m_commands;
+    std::vector<sf::Vertex> m_vertices;
+    std::vector<sf::View> m_views;
+    std::vector<Object> m_objects;
+};
+
+} // namespace Engine
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "Engine/Core/Handle.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+
+/// Previous / current render transforms of every interpolated object,
+/// blended in one pass before drawing.
+///
+/// The simulation runs at a fixed 60 Hz, but the display may refresh
+/// faster or slower; drawing the latest simulated position makes motion
+/// stutter. Each object instead registers a slot here and reports its
+/// state after every update with set(). The Application calls
+/// snapshot() before each fixed update and blend(alpha) once before
+/// drawing, where alpha = accumulator / dt. Scenes then draw at
+/// getPosition() / getRotation(), which lag the simulation by at most one
+/// tick but move smoothly at any refresh rate.
+///
+/// The state lives in three flat float arrays (previous, current,
+/// blended; x, y, rotation per slot), so snapshot() is a copy and
+/// blend() is one SIMD lerp over the whole buffer, with no per-object
+/// calls.
+///
+/// Usage:
+/// @code
+///   m_body = ctx.interpolation.add(m_position);        // init()
+///   ctx.interpolation.set(m_body, m_position);         // update()
+///   m_shape.setPosition(ctx.interpolation.getPosition(m_body)); // draw()
+///   ctx.interpolation.remove(m_body);                  // destructor
+/// @endcode
+class InterpolationBuffer {
+public:
+    using Handle = Engine::Handle<InterpolationBuffer>;
+
+    InterpolationBuffer() = default;
+    ~InterpolationBuffer() = default;
+
+    // Non-copyable, movable
+    InterpolationBuffer(const InterpolationBuffer&) = delete;
+    InterpolationBuffer& operator=(const InterpolationBuffer&) = delete;
+    InterpolationBuffer(InterpolationBuffer&&) = default;
+    InterpolationBuffer& operator=(InterpolationBuffer&&) = default;
+
+    /// Register an object at the given transform (previous = current).
+    Handle add(sf::Vector2f position, sf::Angle rotation = sf::Angle::Zero);
+
+    /// Unregister an object. Stale handles are ignored.
+    void remove(Handle handle);
+
+    /// Check whether the handle refers to a registered object.
+    [[nodiscard]] bool isValid(Handle handle) const;
+
+    /// Report the object's state after a simulation step. Rotation takes
+    /// the shortest way from the previous rotation.
+    void set(Handle handle, sf::Vector2f position, sf::Angle rotation = sf::Angle::Zero);
+
+    /// Move the object without interpolating (spawn, respawn, portal):
+    /// previous and current are both set.
+    void teleport(Handle handle, sf::Vector2f position, sf::Angle rotation = sf::Angle::Zero);
+
+    /// Copy current into previous. Called before every fixed update.
+    void snapshot();
+
+    /// Compute every blended transform: previous + (current - previous) * alpha.
+    /// @param alpha Interpolation factor in [0, 1] (accumulator / dt).
+    void blend(float alpha);
+
+    /// Get the blended position (as of the last blend()).
+    [[nodiscard]] sf::Vector2f getPosition(Handle handle) const;
+
+    /// Get the blended rotation (as of the last blend()).
+    [[nodiscard]] sf::Angle getRotation(Handle handle) const;
+
+    /// Get the number of registered objects.
+    [[nodiscard]] std::size_t size() const;
+
+    /// Pre-allocate room for `capacity` objects.
+    void reserve(std::size_t capacity);
+
+private:
+    static constexpr std::size_t Channels = 3; ///< x, y, rotation (degrees)
+    static constexpr std::uint32_t Npos = Handle::InvalidIndex;
+
+    struct Slot {
+        std::uint32_t dense = Npos; ///< Live: index into the arrays. Free: next free slot.
+        std::uint32_t generation = 0;
+        bool live = false;
+    };
+
+    [[nodiscard]] std::size_t offset(Handle handle) const;
+
+    std::vector<float> m_previous; ///< Channels floats per object.
+    std::vector<float> m_current;
+    std::vector<float> m_blended;
+    std::vector<std::uint32_t> m_owners; ///< Dense index -> slot.
+    std::vector<Slot> m_slots;
+    std::uint32_t m_freeHead = Npos;
+};
+
+} // namespace Engine
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "Engine/Graphics/CommandList.hpp"
+#include "Engine/Graphics/RenderStats.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine {
+
+/// Draw ordering chosen by the caller: layers are drawn back to front,
+/// and within a layer lower depth values are drawn first.
+struct DrawOrder {
+    std::uint8_t layer = 0;  ///< Coarse ordering (background, world, effects...).
+    std::uint16_t depth = 0; ///< Fine ordering inside a layer (e.g. y-sorting).
+};
+
+/// Packed 64-bit sort key for render commands.
+///
+/// Bit layout, most significant first:
+///   [63..56] layer   (8 bits)
+///   [55..40] depth   (16 bits)
+///   [39..28] shader  (12 bits, interned id)
+///   [27..8]  texture (20 bits, interned id)
+///   [7..0]   blend   (8 bits, interned id)
+///
+/// Sorting on the whole key gives correct layering first and then groups
+/// commands that share GPU state, so they can be merged into one draw call.
+namespace SortKey {
+
+    inline constexpr unsigned LayerShift   = 56;
+    inline constexpr unsigned DepthShift   = 40;
+    inline constexpr unsigned ShaderShift  = 28;
+    inline constexpr unsigned TextureShift = 8;
+    inline constexpr unsigned BlendShift   = 0;
+
+    inline constexpr std::uint64_t ShaderMask  = 0xFFF;
+    inline constexpr std::uint64_t TextureMask = 0xFFFFF;
+    inline constexpr std::uint64_t BlendMask   = 0xFF;
+
+    /// Pack the individual fields into a key. State ids are truncated to their field width.
+    [[nodiscard]] constexpr std::uint64_t pack(DrawOrder order, std::uint32_t shader,
+                                               std::uint32_t texture, std::uint32_t blend) {
+        return (static_cast<std::uint64_t>(order.layer) << LayerShift)
+             | (static_cast<std::uint64_t>(order.depth) << DepthShift)
+             | ((shader  & ShaderMask)  << ShaderShift)
+             | ((texture & TextureMask) << TextureShift)
+             | ((blend   & BlendMask)   << BlendShift);
+    }
+
+} // namespace SortKey
+
+/// Deferred render command queue sorted by a packed 64-bit key.
+///
+/// Commands are recorded in any order and drawn on flush(): the queue is
+/// radix-sorted by key, then runs of consecutive quads that share texture,
+/// shader and blend mode are merged into a single draw call.
+///
+/// Textures, shaders and drawables are referenced, not copied; they must
+/// stay alive and unchanged until the next flush().
+///
+/// Usage:
+/// @code
+///   queue.submit(background, {0, 0});
+///   queue.submit(player, {1, static_cast<std::uint16_t>(player.getPosition().y)});
+///   queue.flush(window); // background first, then y-sorted world
+/// @endcode
+class RenderQueue {
+public:
+    RenderQueue() = default;
+    ~RenderQueue() = default;
+
+    // Non-copyable, movable
+    RenderQueue(const RenderQueue&) = delete;
+    RenderQueue& operator=(const RenderQueue&) = delete;
+    RenderQueue(RenderQueue&&) = default;
+    RenderQueue& operator=(RenderQueue&&) = default;
+
+    /// Record an axis-aligned textured quad.
+    /// @param texture     Texture to sample from.
+    /// @param destination Rectangle covered by the quad, in world coordinates.
+    /// @param textureRect Source rectangle in texture pixels.
+    /// @param order       Layer and depth of the quad.
+    /// @param color       Vertex color multiplied with the texture.
+    /// @param blendMode   Blend mode used when the quad is drawn.
+    /// @param shader      Optional shader (nullptr for the fixed pipeline).
+    void submit(const sf::Texture& texture,
+                const sf::FloatRect& destination,
+                const sf::IntRect& textureRect,
+                DrawOrder order,
+                sf::Color color = sf::Color::White,
+                const sf::BlendMode& blendMode = sf::BlendAlpha,
+                const sf::Shader* shader = nullptr);
+
+    /// Record a sprite, honouring its full transform. Mergeable with other quads.
+    void submit(const sf::Sprite& sprite,
+                DrawOrder order,
+                const sf::BlendMode& blendMode = sf::BlendAlpha,
+                const sf::Shader* shader = nullptr);
+
+    /// Record an arbitrary drawable. It is sorted like any other command
+    /// but always issues its own draw call.
+    void submit(const sf::Drawable& drawable, DrawOrder order,
+                const sf::RenderStates& states = sf::RenderStates::Default);
+
+    /// Sort and draw everything recorded since the last flush, then empty the queue.
+    /// @param target The render target to draw into.
+    /// @param stats  Optional recorder that counts the issued draws.
+    /// @return The number of draw calls issued.
+    std::size_t flush(sf::RenderTarget& target, RenderStatsRecorder* stats = nullptr);
+
+    /// Sort and record everything into a command list, then empty the queue.
+    /// @return The number of draw calls recorded.
+    std::size_t flush(CommandList& list, RenderStatsRecorder* stats = nullptr);
+
+    /// Discard all recorded commands without drawing them.
+    void clear();
+
+    /// Check whether any command is waiting to be flushed.
+    [[nodiscard]] bool empty() const;
+
+    /// Get the number of commands waiting to be flushed.
+    [[nodiscard]] std::size_t size() const;
+
+private:
+    /// One recorded submission. Quads reference six vertices in m_vertices;
+    /// drawable commands reference the caller's object.
+    struct Command {
+        const sf::Drawable* drawable = nullptr;
+        sf::RenderStates states;
+        std::size_t firstVertex = 0;
+    };
+
+    /// Sort entry: key plus index into m_commands.
+    struct Entry {
+        std::uint64_t key;
+        std::uint32_t command;
+    };
+
+    /// Shared body of both flush() overloads.
+    template <typename Target>
+    std::size_t flushInto(Target& target, RenderStatsRecorder* stats);
+
+    void pushQuad(const sf::Vector2f (&corners)[4], const sf::IntRect& textureRect,
+                  sf::Color color, const sf::Texture* texture, DrawOrder order,
+                  const sf::BlendMode& blendMode, const sf::Shader* shader);
+
+    void pushCommand(Command command, DrawOrder order);
+
+    std::uint32_t internTexture(const sf::Texture* texture);
+    std::uint32_t internShader(const sf::Shader* shader);
+    std::uint32_t internBlend(const sf::BlendMode& blendMode);
+
+    /// LSD radix sort on the 64-bit key, 8 bits per pass. Stable, so equal
+    /// keys keep submission order. Passes whose byte is constant are skipped.
+    static void radixSort(std::vector<Entry>& entries, std::vector<Entry>& scratch);
+
+    std::vector<Command> m_commands;
+    std::vector<sf::Vertex> m_vertices; ///< Quad vertices in submission order.
+    std::vector<sf::Vertex> m_merged;   ///< Scratch buffer for merged runs.
+    std::vector<Entry> m_entries;
+    std::vector<Entry> m_scratch;
+
+    // Per-flush state ids (0 is reserved for "none")
+    std::unordered_map<const void*, std::uint32_t> m_textureIds;
+    std::unordered_map<const void*, std::uint32_t> m_shaderIds;
+    std::vector<sf::BlendMode> m_blendModes;
+};
+
+} // namespace Engine
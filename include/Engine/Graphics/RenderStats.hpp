@@ -0,0 +1,83 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+
+namespace Engine {
+
+/// What the renderer did during one frame.
+struct RenderStats {
+    std::size_t drawCalls = 0;    ///< Draw calls issued (a batch group or merged run counts once).
+    std::size_t vertices = 0;     ///< Vertices submitted, where known (see RenderStatsRecorder).
+    std::size_t textureBinds = 0; ///< Draws whose texture differs from the previous draw's.
+    std::size_t viewChanges = 0;  ///< Calls to Renderer::setView().
+    std::size_t clears = 0;       ///< Calls to Renderer::clear().
+    float displayTime = 0.f;      ///< Seconds spent in Renderer::display().
+};
+
+/// Counts renderer work for the frame being built and keeps a rolling
+/// history of finished frames.
+///
+/// The Renderer feeds it from every draw path (immediate draws, sprite
+/// batches, the command queue and static layers) and closes the frame in
+/// display(). Vertex counts are exact for raw vertices, vertex buffers,
+/// batches, queued quads, sprites and shapes; text is estimated at six
+/// vertices per character, and arbitrary sf::Drawable types count as a
+/// draw call with no vertices.
+///
+/// Usage:
+/// @code
+///   const auto& stats = ctx.renderStats;
+///   auto last = stats.getLast();    // The last displayed frame
+///   auto avg  = stats.getAverage(); // Mean over the history window
+/// @endcode
+class RenderStatsRecorder {
+public:
+    /// Number of finished frames kept in the history.
+    static constexpr std::size_t HistorySize = 240;
+
+    /// Count one draw call.
+    /// @param texture     Texture bound for the draw (nullptr if untextured or unknown).
+    /// @param vertexCount Number of vertices drawn.
+    void countDraw(const sf::Texture* texture, std::size_t vertexCount);
+
+    /// Count one clear of the render target.
+    void countClear();
+
+    /// Count one view change.
+    void countViewChange();
+
+    /// Close the current frame: push it into the history and start a new one.
+    /// @param displayTime Seconds spent presenting the frame.
+    void endFrame(float displayTime);
+
+    /// Get the counters of the frame being built.
+    [[nodiscard]] const RenderStats& getCurrent() const;
+
+    /// Get the last finished frame (all zero before the first display()).
+    [[nodiscard]] RenderStats getLast() const;
+
+    /// Get a finished frame from the history.
+    /// @param framesAgo 0 for the last frame, up to getHistoryCount() - 1.
+    [[nodiscard]] RenderStats getFrame(std::size_t framesAgo) const;
+
+    /// Get the number of finished frames in the history.
+    [[nodiscard]] std::size_t getHistoryCount() const;
+
+    /// Get the per-counter mean over the history (counts are rounded down).
+    [[nodiscard]] RenderStats getAverage() const;
+
+    /// Get the per-counter maximum over the history.
+    [[nodiscard]] RenderStats getPeak() const;
+
+private:
+    RenderStats m_current;
+    const sf::Texture* m_boundTexture = nullptr; ///< Texture of the previous draw.
+
+    std::array<RenderStats, HistorySize> m_history{};
+    std::size_t m_historyNext = 0;
+    std::size_t m_historyCount = 0;
+};
+
+} // namespace Engine
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Engine/Graphics/CommandList.hpp"
+#include <SFML/Graphics.hpp>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Engine {
+
+/// Worker thread that owns a render target's OpenGL context and replays
+/// recorded command lists into it.
+///
+/// The recording thread hands over frame N with submit() and immediately
+/// starts recording frame N+1 into another list, while this thread draws
+/// and presents frame N. submit() is the sync point: it first waits for
+/// the previous frame to finish, so at most one frame is in flight.
+///
+/// The target's context must not be active on any other thread while the
+/// render thread runs. Work that needs the context (or resources the
+/// in-flight frame reads) goes through execute() instead.
+class RenderThread {
+public:
+    /// Called on the render thread after a list is replayed (e.g. window.display()).
+    using PresentFunction = std::function<void()>;
+
+    /// Start the thread and activate the target's context on it.
+    /// @throws std::runtime_error if the context cannot be activated on the thread.
+    RenderThread(sf::RenderTarget& target, PresentFunction present);
+
+    /// Finish the frame in flight, deactivate the context and join the thread.
+    ~RenderThread();
+
+    // Non-copyable, non-movable (owns a running thread)
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+    RenderThread(RenderThread&&) = delete;
+    RenderThread& operator=(RenderThread&&) = delete;
+
+    /// Wait for the previous frame to finish, then hand over the next one.
+    /// The list must not be touched again until the following submit() returns.
+    void submit(const CommandList& list);
+
+    /// Block until no frame is in flight.
+    void waitIdle();
+
+    /// Wait for the frame in flight, then run a task on the render thread
+    /// and block until it returns. Exceptions thrown by the task are
+    /// rethrown here.
+    void execute(const std::function<void()>& task);
+
+private:
+    void run();
+
+    sf::RenderTarget& m_target;
+    PresentFunction m_present;
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    const CommandList* m_pending = nullptr; ///< Frame handed over but not yet picked up.
+    const std::function<void()>* m_task = nullptr; ///< execute() task not yet run.
+    std::exception_ptr m_taskError;         ///< Exception thrown by the last task.
+    bool m_busy = false;                    ///< A frame or task is being run.
+    bool m_started = false;                 ///< The thread tried to activate the context.
+    bool m_failed = false;                  ///< Context activation failed; the thread exited.
+    bool m_stop = false;
+
+    std::thread m_thread; ///< Declared last: started after all other members exist.
+};
+
+} // namespace Engine
@@ -1,10 +1,31 @@
 #pragma once
 
+#include "Engine/Graphics/CommandList.hpp"
+#include "Engine/Graphics/RenderQueue.hpp"
+#include "Engine/Graphics/RenderStats.hpp"
+#include "Engine/Graphics/RenderThread.hpp"
+#include "Engine/Graphics/SpriteBatch.hpp"
+#include "Engine/Graphics/StaticLayer.hpp"
 #include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace Engine {
 
+/// Where the Renderer draws.
+enum class RenderMode {
+    Windowed,  ///< A visible sf::RenderWindow.
+    Offscreen  ///< An sf::RenderTexture; no window is opened (CI, benchmarks, golden images).
+};
+
 /// Abstraction layer over sf::RenderWindow for all rendering operations.
 ///
 /// Decouples game code from direct window manipulation. Scenes draw
@@ -12,15 +33,20 @@ namespace Engine {
 /// This enables future enhancements like render-to-texture, viewports,
 /// or batching without changing scene code.
 ///
-/// The Renderer owns the sf::RenderWindow instance.
+/// The Renderer owns the sf::RenderWindow instance. In offscreen mode it
+/// owns an sf::RenderTexture instead, and frames can be captured, hashed
+/// or saved for regression checks.
 class Renderer {
 public:
     /// Create a renderer with a window of the given size and title.
     /// @param width  Window width in pixels.
     /// @param height Window height in pixels.
-    /// @param title  Window title string.
-    Renderer(unsigned int width, unsigned int height, const std::string& title);
-    ~Renderer() = default;
+    /// @param title  Window title string (ignored offscreen).
+    /// @param mode   Draw to a window or to an offscreen render texture.
+    /// @throws std::runtime_error if the offscreen target cannot be created.
+    Renderer(unsigned int width, unsigned int height, const std::string& title,
+             RenderMode mode = RenderMode::Windowed);
+    ~Renderer();
 
     // Non-copyable, non-movable (owns the window)
     Renderer(const Renderer&) = delete;
@@ -32,27 +58,205 @@ public:
     void clear(sf::Color color = sf::Color::Black);
 
     /// Draw any SFML drawable object.
+    /// Immediate draws are ordering barriers: queued commands are flushed first.
     void draw(const sf::Drawable& drawable);
 
     /// Draw a drawable with a render states configuration.
     void draw(const sf::Drawable& drawable, const sf::RenderStates& states);
 
+    /// Draw raw vertices (no culling).
+    void draw(const sf::Vertex* vertices, std::size_t vertexCount,
+              sf::PrimitiveType type, const sf::RenderStates& states = sf::RenderStates::Default);
+
+    /// Draw a range of a vertex buffer (no culling).
+    void draw(const sf::VertexBuffer& buffer, std::size_t firstVertex, std::size_t vertexCount,
+              const sf::RenderStates& states = sf::RenderStates::Default);
+
+    /// Draw a sprite, skipping it if it lies outside the current view.
+    void draw(const sf::Sprite& sprite);
+
+    /// Draw a shape, skipping it if it lies outside the current view.
+    void draw(const sf::Shape& shape);
+
+    /// Draw a text, skipping it if it lies outside the current view.
+    void draw(const sf::Text& text);
+
+    /// Draw a vertex array, skipping it if it lies outside the current view.
+    void draw(const sf::VertexArray& vertices);
+
+    // ---- View culling ----
+
+    /// Objects drawn vs culled during a frame. Only submissions with known
+    /// world bounds (sprites, shapes, texts, vertex arrays, batched and
+    /// queued quads) are tested and counted.
+    struct CullStats {
+        std::size_t drawn = 0;  ///< Submissions that overlapped the view.
+        std::size_t culled = 0; ///< Submissions dropped before reaching SFML.
+    };
+
+    /// Enable or disable view culling (enabled by default).
+    void setCullingEnabled(bool enabled);
+
+    /// Check whether view culling is enabled.
+    [[nodiscard]] bool isCullingEnabled() const;
+
+    /// Get the world-space bounding box of the current view.
+    [[nodiscard]] const sf::FloatRect& getViewBounds() const;
+
+    /// Check whether a world-space rectangle overlaps the current view.
+    /// Useful for scenes that want to skip work for off-screen objects.
+    [[nodiscard]] bool isVisible(const sf::FloatRect& worldBounds) const;
+
+    /// Get the culling counters of the previous frame.
+    [[nodiscard]] const CullStats& getCullStats() const;
+
+    // ---- Sprite batching (opt-in) ----
+
+    /// Start collecting quads into texture/blend-keyed batches.
+    /// Quads are drawn at endBatch(), or earlier at an ordering barrier
+    /// (clear(), setView(), an immediate draw()), which draws the quads
+    /// collected so far and keeps the batch open.
+    void beginBatch();
+
+    /// Queue an axis-aligned textured quad into the current batch.
+    /// Dropped (and not counted) if no batch is open.
+    /// @param texture     Texture to sample from. Must stay alive until endBatch().
+    /// @param destination Rectangle covered by the quad, in world coordinates.
+    /// @param textureRect Source rectangle in texture pixels.
+    /// @param color       Vertex color multiplied with the texture.
+    /// @param blendMode   Blend mode used when the quad is drawn.
+    void submit(const sf::Texture& texture,
+                const sf::FloatRect& destination,
+                const sf::IntRect& textureRect,
+                sf::Color color = sf::Color::White,
+                const sf::BlendMode& blendMode = sf::BlendAlpha);
+
+    /// Queue a sprite into the current batch (its texture must outlive endBatch()).
+    /// Dropped (and not counted) if no batch is open.
+    void submit(const sf::Sprite& sprite, const sf::BlendMode& blendMode = sf::BlendAlpha);
+
+    /// Flush the current batch: one draw call per texture/blend pair.
+    void endBatch();
+
+    // ---- Sorted command queue (opt-in) ----
+
+    /// Record a textured quad into the deferred, sorted command queue.
+    /// Queued commands are radix-sorted by layer, depth and GPU state and
+    /// drawn at the next barrier: display(), setView(), clear(), an
+    /// immediate draw() or endBatch(). Everything referenced must stay
+    /// alive until then.
+    void enqueue(const sf::Texture& texture,
+                 const sf::FloatRect& destination,
+                 const sf::IntRect& textureRect,
+                 DrawOrder order,
+                 sf::Color color = sf::Color::White,
+                 const sf::BlendMode& blendMode = sf::BlendAlpha,
+                 const sf::Shader* shader = nullptr);
+
+    /// Record a sprite into the sorted command queue.
+    void enqueue(const sf::Sprite& sprite,
+                 DrawOrder order,
+                 const sf::BlendMode& blendMode = sf::BlendAlpha,
+                 const sf::Shader* shader = nullptr);
+
+    /// Record any drawable into the sorted command queue (never merged).
+    void enqueue(const sf::Drawable& drawable, DrawOrder order,
+                 const sf::RenderStates& states = sf::RenderStates::Default);
+
+    // ---- Static layers (cached render-to-texture) ----
+
+    /// Create a cached layer covering a world rectangle. Creating an ID
+    /// that already exists is a no-op and returns the existing layer.
+    /// @throws std::runtime_error if the render texture cannot be created.
+    StaticLayer& createStaticLayer(const std::string& id, const sf::FloatRect& area);
+
+    /// Retrieve a static layer by its ID.
+    /// @throws std::runtime_error if the layer does not exist.
+    [[nodiscard]] StaticLayer& getStaticLayer(const std::string& id);
+
+    /// Check whether a static layer with the given ID exists.
+    [[nodiscard]] bool hasStaticLayer(const std::string& id) const;
+
+    /// Mark a layer dirty so its content is re-rendered on the next drawStaticLayer().
+    /// @throws std::runtime_error if the layer does not exist.
+    void invalidateStaticLayer(const std::string& id);
+
+    /// Destroy a static layer and its render texture. With a render thread,
+    /// the texture is kept until the frames that may composite it are drawn.
+    void removeStaticLayer(const std::string& id);
+
+    /// Composite a layer as one quad, re-rendering it first only if it is dirty.
+    /// The layer is culled like any other submission.
+    /// @param id     The layer to draw.
+    /// @param redraw Callback drawing the layer's content in world coordinates.
+    /// @throws std::runtime_error if the layer does not exist.
+    void drawStaticLayer(const std::string& id, const StaticLayer::RedrawFunction& redraw);
+
+    /// Get the number of draw calls issued during the previous frame.
+    [[nodiscard]] std::size_t getDrawCallCount() const;
+
+    /// Get the per-frame counters (draw calls, vertices, texture binds,
+    /// view changes, clears, display time) and their rolling history.
+    /// Also available as Context::renderStats.
+    [[nodiscard]] const RenderStatsRecorder& getRenderStats() const;
+
     /// Present the rendered frame to the screen.
     void display();
 
-    /// Check if the window is currently open.
+    // ---- Threaded rendering (opt-in) ----
+
+    /// Move GPU submission to a dedicated render thread.
+    ///
+    /// While enabled, every Renderer call records into a CommandList; at
+    /// display() the list is handed to the render thread, which draws and
+    /// presents it while the caller records the next frame into a second
+    /// list. Call between frames (after display()).
+    ///
+    /// Recorded drawables are copied, so only sf::Sprite, sf::Text,
+    /// sf::CircleShape, sf::RectangleShape, sf::ConvexShape, sf::VertexArray
+    /// and raw vertices can be drawn; other types throw std::runtime_error.
+    /// Textures, fonts and vertex buffers are shared with the render thread.
+    ///
+    /// Shared resources must not be modified while a frame is in flight:
+    /// - Texts are not culled (measuring them loads glyphs into the shared
+    ///   font). For the same reason, do not measure texts (getGlobalBounds(),
+    ///   findCharacterPos(), ...) with glyphs that were never drawn.
+    /// - A dirty static layer is re-rendered on the render thread, after the
+    ///   frame in flight finishes, so drawStaticLayer() stalls on such frames.
+    /// - Vertex buffers are updated through runOnRenderThread() (TileMap
+    ///   does so for its chunks), which stalls the same way.
+    /// - setVerticalSyncEnabled() and setFramerateLimit() are applied on the
+    ///   render thread between frames.
+    /// @throws std::runtime_error if the render context cannot be handed over.
+    void setThreadedRendering(bool enabled);
+
+    /// Check whether a render thread is running.
+    [[nodiscard]] bool isThreadedRendering() const;
+
+    /// Run a task on the render thread once the frame in flight is done,
+    /// blocking until it returns; without a render thread, run it directly.
+    /// Modify shared GPU resources that recorded frames reference (vertex
+    /// buffers, textures) through this while threaded rendering is on.
+    /// Exceptions thrown by the task are rethrown here.
+    void runOnRenderThread(const std::function<void()>& task);
+
+    /// Check if the window is currently open (offscreen: until close() is called).
     [[nodiscard]] bool isOpen() const;
 
-    /// Close the window.
+    /// Close the window (offscreen: mark the renderer closed).
     void close();
 
     /// Set the framerate limit.
     void setFramerateLimit(unsigned int limit);
 
+    /// Enable or disable vertical synchronization.
+    void setVerticalSyncEnabled(bool enabled);
+
     /// Get the window size.
     [[nodiscard]] sf::Vector2u getSize() const;
 
-    /// Set the window view (camera).
+    /// Set the window view (camera). Also updates the rectangle used for culling,
+    /// so set views through the Renderer rather than through getWindow().
     void setView(const sf::View& view);
 
     /// Get the current window view.
@@ -64,11 +268,83 @@ public:
     /// Get direct access to the underlying sf::RenderWindow.
     /// Prefer using Renderer methods, but this is available for
     /// advanced use cases (e.g., polling events in InputManager).
+    /// @throws std::runtime_error in offscreen mode.
     [[nodiscard]] sf::RenderWindow& getWindow();
     [[nodiscard]] const sf::RenderWindow& getWindow() const;
 
+    /// Get the render target in use (window or offscreen texture).
+    /// Do not draw to it directly while threaded rendering is enabled.
+    [[nodiscard]] sf::RenderTarget& getTarget();
+
+    // ---- Offscreen mode ----
+
+    /// Check whether the renderer draws to an offscreen texture.
+    [[nodiscard]] bool isOffscreen() const;
+
+    /// Copy the last displayed frame to an image.
+    /// @throws std::runtime_error if not in offscreen mode.
+    [[nodiscard]] sf::Image captureFrame() const;
+
+    /// Hash the last displayed frame's pixels (64-bit FNV-1a).
+    /// Equal hashes across runs mean pixel-identical frames.
+    /// @throws std::runtime_error if not in offscreen mode.
+    [[nodiscard]] std::uint64_t hashFrame() const;
+
+    /// Save the last displayed frame to an image file (PNG, BMP, ...).
+    /// @throws std::runtime_error if not in offscreen mode or the file cannot be written.
+    void saveFrame(const std::filesystem::path& filename) const;
+
 private:
-    sf::RenderWindow m_window;
+    std::optional<sf::RenderWindow> m_window;     ///< Set in windowed mode.
+    std::optional<sf::RenderTexture> m_offscreen; ///< Set in offscreen mode.
+    sf::RenderTarget* m_target = nullptr;         ///< Whichever of the two is in use.
+    bool m_offscreenOpen = false;
+    sf::View m_currentView;                       ///< Mirror of the view being recorded.
+
+    std::array<CommandList, 2> m_lists;           ///< Double buffer: recording / in flight.
+    std::size_t m_recordIndex = 0;
+    std::unique_ptr<RenderThread> m_renderThread; ///< Set while threaded rendering is on.
+    SpriteBatch m_batch;
+    RenderQueue m_queue;
+    std::unordered_map<std::string, std::unique_ptr<StaticLayer>> m_staticLayers;
+    std::array<std::vector<std::unique_ptr<StaticLayer>>, 2> m_retiredLayers; ///< Removed while recording into m_lists[i].
+
+    RenderStatsRecorder m_stats;
+
+    sf::FloatRect m_viewBounds;  ///< World-space AABB of the current view.
+    bool m_cullingEnabled = true;
+    CullStats m_cullStats;       ///< Counters of the frame being built.
+    CullStats m_lastCullStats;   ///< Counters of the last displayed frame.
+
+    /// Test bounds against the view and update the counters.
+    /// @return True if the submission should be dropped.
+    bool cull(const sf::FloatRect& worldBounds);
+
+    /// Recompute m_viewBounds from the window's current view.
+    void updateViewBounds();
+
+    /// Draw and empty the command queue.
+    void flushQueue();
+
+    /// Draw everything recorded before an ordering barrier: the command
+    /// queue and the quads of the open batch.
+    void flushPending();
+
+    /// Call fn with the current draw destination: the target itself, or
+    /// the recording CommandList when a render thread is running.
+    template <typename Fn>
+    void forTarget(Fn&& fn);
+
+    /// Call fn on the render thread between frames (blocking), or directly
+    /// when there is none.
+    template <typename Fn>
+    void onRenderThread(Fn&& fn);
+
+    /// Draw a typed drawable as an ordering barrier; the caller counts it.
+    void drawCounted(const sf::Drawable& drawable);
+
+    /// Present the target (window display / render texture display).
+    void present();
 };
 
 } // namespace Engine
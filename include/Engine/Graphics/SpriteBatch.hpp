@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Engine/Graphics/CommandList.hpp"
+#include "Engine/Graphics/RenderStats.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace Engine {
+
+/// Accumulates textured quads and draws them grouped by texture and blend mode.
+///
+/// Every distinct (texture, blend mode) pair becomes one vertex array that is
+/// flushed with a single draw call, instead of one draw call per sprite.
+/// Vertex storage is kept between frames, so a steady-state frame does not
+/// allocate.
+///
+/// Quads sharing a texture and blend mode keep their submission order.
+/// Groups are drawn in the order their first quad was submitted, so
+/// overlapping quads from *different* textures may be reordered.
+///
+/// Usage:
+/// @code
+///   batch.begin();
+///   for (const auto& s : sprites) batch.submit(s);
+///   batch.end(window); // one draw call per texture/blend pair
+/// @endcode
+class SpriteBatch {
+public:
+    SpriteBatch() = default;
+    ~SpriteBatch() = default;
+
+    // Non-copyable, movable
+    SpriteBatch(const SpriteBatch&) = delete;
+    SpriteBatch& operator=(const SpriteBatch&) = delete;
+    SpriteBatch(SpriteBatch&&) = default;
+    SpriteBatch& operator=(SpriteBatch&&) = default;
+
+    /// Start collecting quads. Discards anything left from a previous batch.
+    void begin();
+
+    /// Queue an axis-aligned textured quad.
+    /// @param texture     Texture to sample from. Must outlive the call to end().
+    /// @param destination Rectangle covered by the quad, in world coordinates.
+    /// @param textureRect Source rectangle in texture pixels.
+    /// @param color       Vertex color multiplied with the texture.
+    /// @param blendMode   Blend mode used when the quad is drawn.
+    void submit(const sf::Texture& texture,
+                const sf::FloatRect& destination,
+                const sf::IntRect& textureRect,
+                sf::Color color = sf::Color::White,
+                const sf::BlendMode& blendMode = sf::BlendAlpha);
+
+    /// Queue a sprite, honouring its full transform (position, rotation, scale, origin).
+    /// @param sprite    The sprite to copy geometry from.
+    /// @param blendMode Blend mode used when the quad is drawn.
+    void submit(const sf::Sprite& sprite, const sf::BlendMode& blendMode = sf::BlendAlpha);
+
+    /// Draw every accumulated group to the target and close the batch.
+    /// @param target The render target to flush into.
+    /// @param stats  Optional recorder that counts the issued draws.
+    /// @return The number of draw calls issued.
+    std::size_t end(sf::RenderTarget& target, RenderStatsRecorder* stats = nullptr);
+
+    /// Record every accumulated group into a command list and close the batch.
+    /// @return The number of draw calls recorded.
+    std::size_t end(CommandList& list, RenderStatsRecorder* stats = nullptr);
+
+    /// Check whether begin() has been called without a matching end().
+    [[nodiscard]] bool isActive() const;
+
+    /// Get the number of quads queued since begin().
+    [[nodiscard]] std::size_t getQuadCount() const;
+
+private:
+    /// Vertices for one texture/blend pair, drawn as a triangle list.
+    struct Batch {
+        const sf::Texture* texture = nullptr;
+        sf::BlendMode blendMode;
+        std::vector<sf::Vertex> vertices;
+    };
+
+    /// Shared body of both end() overloads.
+    template <typename Target>
+    std::size_t endInto(Target& target, RenderStatsRecorder* stats);
+
+    /// Find (or open) the group for a texture/blend pair.
+    Batch& batchFor(const sf::Texture& texture, const sf::BlendMode& blendMode);
+
+    /// Append the two triangles of a quad given its corners in draw order
+    /// top-left, top-right, bottom-left, bottom-right.
+    static void appendQuad(Batch& batch, const sf::Vector2f (&corners)[4],
+                           const sf::IntRect& textureRect, sf::Color color);
+
+    std::vector<Batch> m_batches;   ///< Groups, reused across frames.
+    std::size_t m_batchCount = 0;   ///< Groups in use this batch.
+    std::size_t m_lastBatch = 0;    ///< Cache for consecutive same-texture submits.
+    std::size_t m_quadCount = 0;
+    bool m_active = false;
+};
+
+} // namespace Engine
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Engine/Graphics/CommandList.hpp"
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <functional>
+
+namespace Engine {
+
+/// Cached render-to-texture layer for content that rarely changes.
+///
+/// The layer covers a fixed world rectangle. Its content is rendered once
+/// into an sf::RenderTexture and then composited every frame as a single
+/// textured quad. It is only re-rendered after invalidate() is called.
+///
+/// Usually created and drawn through the Renderer:
+/// @code
+///   renderer.createStaticLayer("decor", {{0.f, 0.f}, {2048.f, 2048.f}});
+///   // Every frame:
+///   renderer.drawStaticLayer("decor", [&](sf::RenderTarget& target) {
+///       for (const auto& tile : m_decor) target.draw(tile); // only runs when dirty
+///   });
+///   // After editing the decor:
+///   renderer.invalidateStaticLayer("decor");
+/// @endcode
+class StaticLayer {
+public:
+    /// Callback that draws the layer's content. The target's view already
+    /// maps the layer's world rectangle, so content is drawn in world coordinates.
+    using RedrawFunction = std::function<void(sf::RenderTarget&)>;
+
+    /// Create a layer covering the given world rectangle (one texel per world unit).
+    /// @param area World rectangle covered by the layer.
+    /// @throws std::runtime_error if the render texture cannot be created
+    ///         (e.g. the area exceeds sf::Texture::getMaximumSize()).
+    explicit StaticLayer(const sf::FloatRect& area);
+    ~StaticLayer() = default;
+
+    // Non-copyable, non-movable (owns a render texture)
+    StaticLayer(const StaticLayer&) = delete;
+    StaticLayer& operator=(const StaticLayer&) = delete;
+    StaticLayer(StaticLayer&&) = delete;
+    StaticLayer& operator=(StaticLayer&&) = delete;
+
+    /// Mark the content as changed; it is re-rendered the next time it is refreshed.
+    void invalidate();
+
+    /// Check whether the content needs to be re-rendered.
+    [[nodiscard]] bool isDirty() const;
+
+    /// Re-render the content if it is dirty.
+    /// @param redraw Callback drawing the layer's content.
+    /// @return True if the content was re-rendered.
+    bool refresh(const RedrawFunction& redraw);
+
+    /// Draw the cached content as a single quad.
+    void composite(sf::RenderTarget& target,
+                   const sf::RenderStates& states = sf::RenderStates::Default) const;
+
+    /// Get the texture holding the cached content.
+    [[nodiscard]] const sf::Texture& getTexture() const;
+
+    /// Record the cached content as a single quad into a command list.
+    void composite(CommandList& list,
+                   const sf::RenderStates& states = sf::RenderStates::Default) const;
+
+    /// Get the world rectangle covered by the layer.
+    [[nodiscard]] const sf::FloatRect& getArea() const;
+
+    /// Set the color the texture is cleared to before re-rendering (default: transparent).
+    void setClearColor(sf::Color color);
+
+private:
+    sf::RenderTexture m_texture;
+    sf::FloatRect m_area;
+    sf::Color m_clearColor = sf::Color::Transparent;
+    std::array<sf::Vertex, 6> m_quad;
+    bool m_dirty = true;
+};
+
+} // namespace Engine
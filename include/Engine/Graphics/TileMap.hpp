@@ -0,0 +1,122 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+
+class Renderer;
+
+/// Chunked tilemap renderer.
+///
+/// The map is split into square chunks of tiles. Each chunk keeps its
+/// geometry in a static-usage sf::VertexBuffer that is rebuilt only when
+/// a tile inside it changes, and only chunks overlapping the renderer's
+/// current view are visited. Per-frame cost therefore depends on the
+/// screen size, not on the map size.
+///
+/// Tiles are indices into a tileset texture laid out left to right, top
+/// to bottom. TileMap::Empty marks a cell with no tile.
+///
+/// Usage:
+/// @code
+///   TileMap map({4096, 4096}, {16, 16}, ctx.textures.get("tiles"));
+///   map.setTile({10, 5}, 3);
+///   // In draw (after camera.applyTo(renderer)):
+///   map.draw(renderer);
+/// @endcode
+class TileMap {
+public:
+    using TileId = std::uint16_t;
+
+    /// Tile value for cells that draw nothing.
+    static constexpr TileId Empty = 0xFFFF;
+
+    /// Create an empty map.
+    /// @param mapSize   Map size in tiles.
+    /// @param tileSize  Tile size in pixels (in the tileset and in the world).
+    /// @param tileset   Texture holding the tile images. Must outlive the map.
+    /// @param chunkSize Chunk edge length in tiles.
+    TileMap(sf::Vector2u mapSize, sf::Vector2u tileSize,
+            const sf::Texture& tileset, unsigned int chunkSize = 32);
+    ~TileMap() = default;
+
+    // Non-copyable, movable
+    TileMap(const TileMap&) = delete;
+    TileMap& operator=(const TileMap&) = delete;
+    TileMap(TileMap&&) = default;
+    TileMap& operator=(TileMap&&) = default;
+
+    /// Set the tile of a cell and mark its chunk for rebuilding.
+    /// Out-of-range cells are ignored.
+    void setTile(sf::Vector2u cell, TileId tile);
+
+    /// Get the tile of a cell (Empty if out of range).
+    [[nodiscard]] TileId getTile(sf::Vector2u cell) const;
+
+    /// Set every cell to the same tile.
+    void fill(TileId tile);
+
+    /// Draw the chunks that overlap the renderer's current view.
+    /// Dirty chunks are rebuilt first, within the rebuild budget. With
+    /// threaded rendering the rebuilds run on the render thread, so a
+    /// frame that rebuilds chunks waits for the frame in flight.
+    void draw(Renderer& renderer);
+
+    /// Limit how many already-built chunks may be rebuilt per draw().
+    /// Chunks over budget keep their previous geometry for a frame.
+    /// Chunks that were never built are always built. 0 means unlimited.
+    void setRebuildBudget(std::size_t chunksPerFrame);
+
+    /// Set the world position of the map's top-left corner.
+    void setPosition(sf::Vector2f position);
+
+    /// Get the world position of the map's top-left corner.
+    [[nodiscard]] sf::Vector2f getPosition() const;
+
+    /// Get the map size in tiles.
+    [[nodiscard]] sf::Vector2u getMapSize() const;
+
+    /// Get the tile size in pixels.
+    [[nodiscard]] sf::Vector2u getTileSize() const;
+
+    /// Get the number of chunks drawn by the last draw() call.
+    [[nodiscard]] std::size_t getDrawnChunkCount() const;
+
+private:
+    /// Geometry of one chunk. Uses a vertex buffer when the GPU supports
+    /// them, otherwise falls back to a CPU vertex list.
+    struct Chunk {
+        sf::VertexBuffer buffer{sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Static};
+        std::vector<sf::Vertex> fallback;
+        std::size_t vertexCount = 0;
+        bool dirty = true;
+        bool built = false;
+    };
+
+    /// Regenerate a chunk's geometry from the tile grid.
+    void rebuild(Chunk& chunk, sf::Vector2u chunkCoords);
+
+    /// Get the chunk containing a cell.
+    Chunk& chunkAt(sf::Vector2u cell);
+
+    sf::Vector2u m_mapSize;
+    sf::Vector2u m_tileSize;
+    const sf::Texture* m_tileset;
+    unsigned int m_chunkSize;
+    sf::Vector2u m_chunkCount;
+    sf::Vector2f m_position{0.f, 0.f};
+
+    std::vector<TileId> m_tiles; ///< Row-major, m_mapSize.x * m_mapSize.y.
+    std::vector<Chunk> m_chunks; ///< Row-major, m_chunkCount.x * m_chunkCount.y.
+    std::vector<sf::Vertex> m_scratch; ///< Reused while rebuilding a chunk.
+    std::vector<std::size_t> m_rebuildQueue; ///< draw(): chunks rebuilt this frame.
+
+    std::size_t m_rebuildBudget = 4;
+    std::size_t m_drawnChunks = 0;
+    bool m_useBuffers;
+};
+
+} // namespace Engine
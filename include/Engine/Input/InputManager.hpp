@@ -50,6 +50,9 @@ public:
     /// Poll all pending SFML window events.
     /// Must be called once per frame before any input queries.
     /// Handles window close events internally by closing the window.
+    /// An offscreen renderer has no window: no events are produced and
+    /// real-time queries report nothing held, so runs are reproducible
+    /// whatever the host keyboard and mouse do.
     /// @param renderer The renderer that owns the window to poll events from.
     void pollEvents(Renderer& renderer);
 
@@ -71,10 +74,10 @@ public:
     [[nodiscard]] bool isActionHeld(const Action& action) const;
 
     /// Check if a specific keyboard key is currently held down.
-    [[nodiscard]] static bool isKeyHeld(sf::Keyboard::Key key);
+    [[nodiscard]] bool isKeyHeld(sf::Keyboard::Key key) const;
 
     /// Check if a mouse button is currently held down.
-    [[nodiscard]] static bool isMouseButtonHeld(sf::Mouse::Button button);
+    [[nodiscard]] bool isMouseButtonHeld(sf::Mouse::Button button) const;
 
     /// Get the current mouse position relative to the window.
     [[nodiscard]] sf::Vector2i getMousePosition(const Renderer& renderer) const;
@@ -102,6 +105,9 @@ private:
 
     /// Whether window close was requested this frame.
     bool m_closeRequested = false;
+
+    /// Whether real-time queries read the physical devices (false offscreen).
+    bool m_deviceInput = true;
 };
 
 } // namespace Engine
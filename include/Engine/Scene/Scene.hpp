@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Engine/Script/Scheduler.hpp"
+
 namespace Engine {
 
 /// Abstract base class for all game scenes.
@@ -7,7 +9,7 @@ namespace Engine {
 /// Each scene represents a distinct screen or phase of the game
 /// (e.g., MainMenu, Gameplay, Pause, GameOver).
 ///
-/// Lifecycle: init() -> [handleInput() -> update() -> draw()]* -> ~Scene()
+/// Lifecycle: init() -> [handleInput() -> update() -> scripts -> draw()]* -> ~Scene()
 ///
 /// Scenes are managed by the SceneManager via a stack, enabling
 /// push/pop transitions (e.g., pausing overlays).
@@ -41,6 +43,17 @@ public:
 
     /// Called when the scene above this one is popped.
     virtual void resume() {}
+
+    /// Coroutine scheduler for this scene's behaviour scripts.
+    /// The Application ticks it after every fixed update while the scene
+    /// is active, so behaviours pause with their scene. The SceneManager
+    /// destroys the behaviours before the scene itself, so they may capture
+    /// `this` and the derived scene's members. A scene destroyed elsewhere
+    /// must call scheduler().clear() in its own destructor first.
+    [[nodiscard]] Scheduler& scheduler() { return m_scheduler; }
+
+private:
+    Scheduler m_scheduler;
 };
 
 } // namespace Engine
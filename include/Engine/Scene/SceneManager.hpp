@@ -19,7 +19,7 @@ using SceneRef = std::unique_ptr<Scene>;
 class SceneManager {
 public:
     SceneManager() = default;
-    ~SceneManager() = default;
+    ~SceneManager();
 
     /// Schedule a new scene to be pushed next frame.
     /// @param newScene   The scene to push.
@@ -40,6 +40,9 @@ public:
     [[nodiscard]] bool empty() const;
 
 private:
+    /// Destroy the top scene, stopping its behaviours first.
+    void destroyTop();
+
     std::stack<SceneRef> m_scenes;
     SceneRef m_newScene;
 
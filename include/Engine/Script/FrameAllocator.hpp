@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Engine {
+
+/// Pooled allocator for coroutine frames.
+///
+/// Frames are rounded up to 64-byte size classes and carved out of large
+/// chunks; freed frames go on a per-class free list and are handed out
+/// again before any new memory is taken. After warm-up, starting and
+/// finishing behaviours does not touch the general-purpose heap, and
+/// frames of similar size sit close together in memory. Frames larger
+/// than MaxPooledSize fall back to operator new.
+///
+/// Chunks are only released when the allocator is destroyed (at program
+/// exit). Not thread-safe: create and destroy coroutines on one thread.
+class FrameAllocator {
+public:
+    static constexpr std::size_t Granularity = 64;
+    static constexpr std::size_t MaxPooledSize = 2048;
+    static constexpr std::size_t ChunkSize = 64 * 1024;
+
+    /// Get the allocator used by Task coroutine frames.
+    static FrameAllocator& instance();
+
+    FrameAllocator() = default;
+    ~FrameAllocator() = default;
+
+    // Non-copyable, non-movable (frames point into its chunks)
+    FrameAllocator(const FrameAllocator&) = delete;
+    FrameAllocator& operator=(const FrameAllocator&) = delete;
+    FrameAllocator(FrameAllocator&&) = delete;
+    FrameAllocator& operator=(FrameAllocator&&) = delete;
+
+    /// Allocate a block of at least `size` bytes.
+    [[nodiscard]] void* allocate(std::size_t size);
+
+    /// Return a block. `size` must be the size passed to allocate().
+    void deallocate(void* block, std::size_t size) noexcept;
+
+    /// Get the number of blocks currently handed out.
+    [[nodiscard]] std::size_t getLiveCount() const;
+
+    /// Get the number of bytes reserved in chunks.
+    [[nodiscard]] std::size_t getReservedBytes() const;
+
+private:
+    static constexpr std::size_t ClassCount = MaxPooledSize / Granularity;
+
+    /// Free blocks are linked through their first bytes.
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    std::array<FreeBlock*, ClassCount> m_freeLists{};
+    std::vector<std::unique_ptr<std::byte[]>> m_chunks;
+    std::byte* m_cursor = nullptr;  ///< Next unused byte of the newest chunk.
+    std::size_t m_remaining = 0;    ///< Unused bytes left in the newest chunk.
+    std::size_t m_liveCount = 0;
+};
+
+} // namespace Engine
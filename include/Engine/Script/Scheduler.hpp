@@ -0,0 +1,193 @@
+#pragma once
+
+#include "Engine/Event/EventBus.hpp"
+#include "Engine/Script/Task.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+namespace Engine {
+
+/// Runs behaviour coroutines (Task) and resumes only the ones that are due.
+///
+/// Timed waits sit in a min-heap keyed by wake-up time, so a tick costs
+/// O(k log n) for the k behaviours that actually wake up, plus O(1) for
+/// everything still sleeping. Frame waits and fired events go to a
+/// pending list resumed on the next tick. Behaviours are never resumed
+/// from inside EventBus::publish(); an event only marks its waiter ready.
+///
+/// Time is the sum of the dt values passed to tick() (simulation time),
+/// so runs are reproducible. Wake-ups at the same tick resume in a fixed
+/// order: timers by wake time then start order, then pending behaviours
+/// in the order they became ready.
+///
+/// Every Scene owns one (Scene::scheduler()); the Application ticks the
+/// active scene's scheduler after each fixed update.
+///
+/// Thread safety: NOT thread-safe. All calls must happen on the same thread.
+class Scheduler {
+public:
+    Scheduler() = default;
+    ~Scheduler();
+
+    // Non-copyable, non-movable (running behaviours point back to it)
+    Scheduler(const Scheduler&) = delete;
+    Scheduler& operator=(const Scheduler&) = delete;
+    Scheduler(Scheduler&&) = delete;
+    Scheduler& operator=(Scheduler&&) = delete;
+
+    /// Take ownership of a behaviour and run it until its first suspension.
+    /// Exceptions escaping the behaviour propagate out of start() / tick().
+    void start(Task task);
+
+    /// Advance time and resume every behaviour that is due.
+    /// @param dt Elapsed time in seconds.
+    void tick(float dt);
+
+    /// Destroy every behaviour, waiting or not. Must not be called from
+    /// inside a behaviour or an EventBus handler.
+    void clear();
+
+    /// Get the number of behaviours owned (running or waiting).
+    [[nodiscard]] std::size_t size() const;
+
+    /// Get the scheduler time in seconds.
+    [[nodiscard]] double getTime() const;
+
+    // ---- Used by the awaitables ----
+
+    /// Resume `handle` once `seconds` have elapsed (at the earliest next tick).
+    void resumeAfter(Task::Handle handle, float seconds);
+
+    /// Resume `handle` on the next tick.
+    void resumeNextTick(Task::Handle handle);
+
+private:
+    struct Timer {
+        double wakeTime;
+        std::uint64_t sequence; ///< Tie-breaker for a deterministic order.
+        Task::Handle handle;
+    };
+
+    /// Heap ordering: earliest wake time (then lowest sequence) on top.
+    struct Later {
+        bool operator()(const Timer& a, const Timer& b) const {
+            return a.wakeTime != b.wakeTime ? a.wakeTime > b.wakeTime : a.sequence > b.sequence;
+        }
+    };
+
+    /// Resume once; destroy the frame if the behaviour finished.
+    void resume(Task::Handle handle);
+
+    void unlink(Task::promise_type& promise);
+
+    std::vector<Timer> m_timers;           ///< Min-heap of timed waits.
+    std::vector<Task::Handle> m_pending;   ///< Resume on the next tick.
+    std::vector<Task::Handle> m_resuming;  ///< Batch being resumed (reused storage).
+
+    Task::promise_type* m_head = nullptr;  ///< Owned behaviours (intrusive list).
+    std::size_t m_count = 0;
+    double m_time = 0.0;
+    std::uint64_t m_sequence = 0;
+};
+
+// ---- Awaitables ----
+
+/// Awaitable returned by waitSeconds().
+struct WaitSeconds {
+    float seconds;
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(Task::Handle handle) const {
+        handle.promise().scheduler->resumeAfter(handle, seconds);
+    }
+    void await_resume() const noexcept {}
+};
+
+/// Awaitable returned by nextFrame().
+struct NextFrame {
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(Task::Handle handle) const {
+        handle.promise().scheduler->resumeNextTick(handle);
+    }
+    void await_resume() const noexcept {}
+};
+
+/// Awaitable returned by waitEvent(): subscribes while suspended and
+/// resumes (on the next tick) with a copy of the first matching event.
+template <typename EventType>
+class WaitEvent {
+public:
+    using Filter = std::function<bool(const EventType&)>;
+
+    WaitEvent(EventBus& bus, Filter filter)
+        : m_bus(bus), m_filter(std::move(filter)) {}
+
+    ~WaitEvent() {
+        unsubscribe();
+    }
+
+    // Non-copyable, non-movable (the subscription points to this object)
+    WaitEvent(const WaitEvent&) = delete;
+    WaitEvent& operator=(const WaitEvent&) = delete;
+    WaitEvent(WaitEvent&&) = delete;
+    WaitEvent& operator=(WaitEvent&&) = delete;
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(Task::Handle handle) {
+        m_subscription = m_bus.subscribe<EventType>([this, handle](const EventType& event) {
+            if (m_event || (m_filter && !m_filter(event))) return;
+            m_event.emplace(event);
+            // Deferred: resuming here could unsubscribe while publish() iterates
+            handle.promise().scheduler->resumeNextTick(handle);
+        });
+        m_subscribed = true;
+    }
+
+    EventType await_resume() {
+        unsubscribe();
+        return std::move(*m_event);
+    }
+
+private:
+    void unsubscribe() {
+        if (m_subscribed) {
+            m_bus.unsubscribe<EventType>(m_subscription);
+            m_subscribed = false;
+        }
+    }
+
+    EventBus& m_bus;
+    Filter m_filter;
+    SubscriptionID m_subscription = 0;
+    bool m_subscribed = false;
+    std::optional<EventType> m_event;
+};
+
+/// Suspend the behaviour for `seconds` of scheduler time (0: until the next tick).
+[[nodiscard]] inline WaitSeconds waitSeconds(float seconds) {
+    return WaitSeconds{seconds};
+}
+
+/// Suspend the behaviour until the next tick.
+[[nodiscard]] inline NextFrame nextFrame() {
+    return NextFrame{};
+}
+
+/// Suspend the behaviour until an event of the given type is published
+/// (and passes the optional filter); co_await yields the event.
+/// The bus must outlive the wait.
+/// @code
+///   auto hit = co_await Engine::waitEvent<Damage>(ctx.events,
+///       [id](const Damage& d) { return d.target == id; });
+/// @endcode
+template <typename EventType>
+[[nodiscard]] WaitEvent<EventType> waitEvent(EventBus& bus,
+                                             typename WaitEvent<EventType>::Filter filter = {}) {
+    return WaitEvent<EventType>(bus, std::move(filter));
+}
+
+} // namespace Engine
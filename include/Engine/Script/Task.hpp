@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Engine/Script/FrameAllocator.hpp"
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <utility>
+
+namespace Engine {
+
+class Scheduler;
+
+/// Return type of a behaviour coroutine.
+///
+/// A function returning Task and using co_await is a behaviour script.
+/// It does not run until it is handed to a Scheduler with start(); from
+/// then on the scheduler owns it and destroys it when it finishes (or
+/// when the scheduler is cleared). While suspended on one of the
+/// scheduler's awaitables (waitSeconds(), nextFrame(), waitEvent()) it
+/// costs nothing per tick.
+///
+/// Coroutine frames are allocated from FrameAllocator, not the heap.
+///
+/// Usage:
+/// @code
+///   Engine::Task patrol(Guard& guard) {
+///       for (;;) {
+///           guard.turnAround();
+///           co_await Engine::waitSeconds(3.f);
+///       }
+///   }
+///   scheduler().start(patrol(m_guard));
+/// @endcode
+///
+/// Objects referenced by a behaviour (captured by reference or pointer)
+/// must outlive it.
+class Task {
+public:
+    struct promise_type {
+        Scheduler* scheduler = nullptr;   ///< Set by Scheduler::start().
+        promise_type* prev = nullptr;     ///< Scheduler's intrusive list of owned tasks.
+        promise_type* next = nullptr;
+        std::exception_ptr exception;
+
+        static void* operator new(std::size_t size) {
+            return FrameAllocator::instance().allocate(size);
+        }
+
+        static void operator delete(void* frame, std::size_t size) noexcept {
+            FrameAllocator::instance().deallocate(frame, size);
+        }
+
+        Task get_return_object() {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { exception = std::current_exception(); }
+    };
+
+    using Handle = std::coroutine_handle<promise_type>;
+
+    Task() = default;
+    ~Task() {
+        if (m_handle) m_handle.destroy(); // Never started
+    }
+
+    // Non-copyable, movable
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    Task(Task&& other) noexcept : m_handle(std::exchange(other.m_handle, {})) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (m_handle) m_handle.destroy();
+            m_handle = std::exchange(other.m_handle, {});
+        }
+        return *this;
+    }
+
+    /// Give up ownership of the coroutine (used by Scheduler::start()).
+    [[nodiscard]] Handle release() {
+        return std::exchange(m_handle, {});
+    }
+
+    /// Check whether this Task still owns a coroutine.
+    [[nodiscard]] bool valid() const {
+        return static_cast<bool>(m_handle);
+    }
+
+private:
+    explicit Task(Handle handle) : m_handle(handle) {}
+
+    Handle m_handle;
+};
+
+} // namespace Engine
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Example {
+
+/// Integer handle of a clip in an AnimationLibrary.
+using ClipId = std::uint32_t;
+
+/// Returned by AnimationLibrary::find() for unknown names.
+inline constexpr ClipId InvalidClip = std::numeric_limits<ClipId>::max();
+
+/// A single animation: a sequence of texture sub-rectangles at a given speed.
+struct AnimationClip {
+    std::vector<sf::IntRect> frames; ///< Source rectangles in the sprite sheet.
+    float frameDuration = 0.1f;      ///< Seconds per frame.
+    bool looping = true;             ///< Whether the animation loops.
+    ClipId id = InvalidClip;         ///< Index in the owning library.
+    std::string name;                ///< Name the clip was added under.
+};
+
+/// Shared, append-only set of animation clips.
+///
+/// Clips are defined once (typically per sprite sheet, at load time) and
+/// shared by every SpriteAnimator that plays them, instead of each animator
+/// holding its own copy keyed by string. Names are resolved to a ClipId
+/// once; after that, playing a clip is a pointer assignment and updating an
+/// animator never touches a string or a hash map.
+///
+/// Clips are never modified or removed, and their addresses stay valid while
+/// new ones are added, so animators may keep pointers to them for the
+/// lifetime of the library.
+///
+/// Usage:
+/// @code
+///   AnimationLibrary clips;
+///   const ClipId idle = clips.add("idle", { {{0,0},{32,32}}, {{32,0},{32,32}} }, 0.15f);
+///   const ClipId run  = clips.add("run",  { {{0,32},{32,32}}, {{32,32},{32,32}} }, 0.1f);
+///   animator.play(clips.get(idle));
+/// @endcode
+class AnimationLibrary {
+public:
+    AnimationLibrary() = default;
+
+    // Non-copyable (animators point into it), movable
+    AnimationLibrary(const AnimationLibrary&) = delete;
+    AnimationLibrary& operator=(const AnimationLibrary&) = delete;
+    AnimationLibrary(AnimationLibrary&&) = default;
+    AnimationLibrary& operator=(AnimationLibrary&&) = default;
+
+    /// Define a clip.
+    /// @param name          Unique identifier for this clip.
+    /// @param frames        Ordered list of source rectangles in the sprite sheet.
+    /// @param frameDuration Seconds each frame is displayed.
+    /// @param looping       Whether the clip repeats.
+    /// @return The clip's id (ids are assigned 0, 1, 2, ... in order).
+    /// @throws std::runtime_error if the name is taken, there are no frames
+    ///         or frameDuration is not positive.
+    ClipId add(const std::string& name,
+               std::vector<sf::IntRect> frames,
+               float frameDuration = 0.1f,
+               bool looping = true);
+
+    /// Resolve a name to its id.
+    /// @return The id, or InvalidClip if no clip has this name.
+    [[nodiscard]] ClipId find(std::string_view name) const;
+
+    /// Resolve a name to its id.
+    /// @throws std::runtime_error if no clip has this name.
+    [[nodiscard]] ClipId getId(std::string_view name) const;
+
+    /// Retrieve a clip by id.
+    /// @throws std::runtime_error if the id is out of range.
+    [[nodiscard]] const AnimationClip& get(ClipId id) const;
+
+    /// Check whether a clip with this name exists.
+    [[nodiscard]] bool contains(std::string_view name) const;
+
+    /// Get the number of clips.
+    [[nodiscard]] std::size_t size() const;
+
+private:
+    /// Heterogeneous lookup, so find() does not build a std::string.
+    struct NameHash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view name) const {
+            return std::hash<std::string_view>{}(name);
+        }
+    };
+
+    std::deque<AnimationClip> m_clips; ///< Indexed by ClipId; a deque keeps addresses stable.
+    std::unordered_map<std::string, ClipId, NameHash, std::equal_to<>> m_ids;
+};
+
+} // namespace Example
@@ -1,31 +1,25 @@
 #pragma once
 
+#include "Example/Animation/AnimationLibrary.hpp"
 #include <SFML/Graphics.hpp>
-#include <string>
-#include <unordered_map>
-#include <vector>
+#include <cstdint>
 
 namespace Example {
 
-/// A single animation: a sequence of texture sub-rectangles at a given speed.
-struct Animation {
-    std::vector<sf::IntRect> frames; ///< Source rectangles in the sprite sheet.
-    float frameDuration = 0.1f;      ///< Seconds per frame.
-    bool looping = true;             ///< Whether the animation loops.
-};
-
 /// Frame-based sprite sheet animator.
 ///
-/// Manages multiple named animations for a single sprite. Each animation
-/// is a sequence of IntRects (regions of a sprite sheet) played at a
-/// configurable speed.
+/// Plays clips from a shared AnimationLibrary on a single sprite. The
+/// animator holds only the clip being played, a frame index and a timer,
+/// so thousands of animated entities cost a few bytes each and updating
+/// them is pure arithmetic. The library must outlive its animators.
 ///
 /// Usage:
 /// @code
+///   AnimationLibrary clips;
+///   const ClipId idle = clips.add("idle", { {{0,0},{32,32}}, {{32,0},{32,32}} }, 0.15f);
+///
 ///   SpriteAnimator animator;
-///   animator.addAnimation("idle", { {0,0,32,32}, {32,0,32,32} }, 0.15f);
-///   animator.addAnimation("run",  { {0,32,32,32}, {32,32,32,32}, {64,32,32,32} }, 0.1f);
-///   animator.play("idle");
+///   animator.play(clips.get(idle));
 ///   // In update loop:
 ///   animator.update(dt);
 ///   animator.applyToSprite(mySprite);
@@ -34,20 +28,12 @@ class SpriteAnimator {
 public:
     SpriteAnimator() = default;
 
-    /// Register a named animation.
-    /// @param name         Unique identifier for this animation.
-    /// @param frames       Ordered list of source rectangles in the sprite sheet.
-    /// @param frameDuration Seconds each frame is displayed.
-    /// @param looping      Whether the animation repeats.
-    void addAnimation(const std::string& name,
-                      const std::vector<sf::IntRect>& frames,
-                      float frameDuration = 0.1f,
-                      bool looping = true);
-
-    /// Start playing the named animation. Resets to frame 0 if it's a different
-    /// animation than the current one.
-    /// @param name The animation to play.
-    void play(const std::string& name);
+    /// Start playing a clip. Resets to frame 0 if it's a different clip than
+    /// the current one, or if the current one was stopped.
+    /// @param clip The clip to play (kept by pointer, so it must outlive the
+    ///             animator; play from an AnimationLibrary, not a temporary).
+    void play(const AnimationClip& clip);
+    void play(const AnimationClip&&) = delete;
 
     /// Stop the current animation (stays on current frame).
     void stop();
@@ -63,16 +49,21 @@ public:
     /// Check if the current animation has finished (only relevant for non-looping).
     [[nodiscard]] bool isFinished() const;
 
-    /// Get the name of the currently playing animation (empty if none).
-    [[nodiscard]] const std::string& currentAnimation() const;
+    /// Check if a clip is currently advancing.
+    [[nodiscard]] bool isPlaying() const;
+
+    /// Get the current clip (nullptr if none).
+    [[nodiscard]] const AnimationClip* currentClip() const;
+
+    /// Get the id of the current clip (InvalidClip if none).
+    [[nodiscard]] ClipId currentClipId() const;
 
     /// Get the current frame index within the active animation.
     [[nodiscard]] std::size_t currentFrame() const;
 
 private:
-    std::unordered_map<std::string, Animation> m_animations;
-    std::string m_current;
-    std::size_t m_frameIndex = 0;
+    const AnimationClip* m_clip = nullptr;
+    std::uint32_t m_frameIndex = 0;
     float m_elapsed = 0.f;
     bool m_playing = false;
     bool m_finished = false;
@@ -2,10 +2,16 @@
 
 #include "Engine/Scene/Scene.hpp"
 #include "Engine/Core/Application.hpp"
+#include "Example/UI/RenderStatsHUD.hpp"
 #include <SFML/Graphics.hpp>
+#include <optional>
 
 /// Example scene that demonstrates how to use the modular engine template.
 /// Renders a movable circle controlled with WASD keys (action-mapped).
+/// The player's colour pulses via a coroutine behaviour (see pulse()).
+/// Its simulated position is registered with the engine's
+/// InterpolationBuffer, so it is drawn smoothly at any refresh rate.
+/// F3 toggles the renderer statistics overlay.
 /// Press Escape or close the window to exit.
 ///
 /// This file is meant as a starting point -- replace or modify it
@@ -13,7 +19,7 @@
 class DemoScene : public Engine::Scene {
 public:
     explicit DemoScene(Engine::Context& ctx);
-    ~DemoScene() override = default;
+    ~DemoScene() override;
 
     void init() override;
     void handleInput(float dt) override;
@@ -21,10 +27,18 @@ public:
     void draw(float interpolation) override;
 
 private:
+    /// Behaviour script: alternate the player's colour every second.
+    Engine::Task pulse();
+
     Engine::Context& m_ctx;
 
     sf::CircleShape m_player;
+    sf::Vector2f m_position{640.f, 360.f}; // Simulated position (the shape is placed at draw time)
     sf::Vector2f m_velocity{0.f, 0.f};
+    Engine::InterpolationBuffer::Handle m_body;
+
+    sf::Font m_font;
+    std::optional<Example::RenderStatsHUD> m_statsHud; // Only created if the font loads
 
     static constexpr float Speed = 200.f; // pixels per second
 };
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Engine/ECS/Components.hpp"
+#include "Engine/ECS/Registry.hpp"
 #include <SFML/Graphics.hpp>
 
 namespace Engine { class Renderer; }
@@ -11,11 +13,36 @@ namespace Example {
 /// Provides position, velocity, bounding box, and active state.
 /// Derived classes override update() and draw() to add behavior.
 /// Entities that are not alive are skipped during update/draw loops.
+///
+/// Compatibility facade: the position, velocity and size live as
+/// Engine::Position / Velocity / Size components in an Engine::Registry,
+/// so bulk systems can iterate them contiguously while existing
+/// Entity-based code keeps working. Entities constructed without a
+/// registry use a process-wide one (sharedRegistry()). For large numbers
+/// of objects, use the registry directly instead of one Entity each.
+///
+/// Migrating a subclass: the protected m_position / m_velocity / m_size
+/// members are replaced by the position() / velocity() / size()
+/// accessors, which return references into the registry.
+///
+/// A moved-from Entity owns no registry entity; apart from destruction
+/// and assignment, using it throws std::runtime_error.
 class Entity {
 public:
-    Entity() = default;
+    Entity();
     explicit Entity(sf::Vector2f position, sf::Vector2f size = {0.f, 0.f});
-    virtual ~Entity() = default;
+
+    /// Create the entity's components in the given registry.
+    /// The registry must outlive the Entity.
+    explicit Entity(Engine::Registry& registry, sf::Vector2f position = {0.f, 0.f},
+                    sf::Vector2f size = {0.f, 0.f});
+    virtual ~Entity();
+
+    // Copyable (copies the components into a new registry entity), movable
+    Entity(const Entity& other);
+    Entity& operator=(const Entity& other);
+    Entity(Entity&& other) noexcept;
+    Entity& operator=(Entity&& other) noexcept;
 
     /// Update entity logic each fixed timestep.
     /// @param dt Fixed delta time in seconds.
@@ -42,11 +69,45 @@ public:
     void setAlive(bool alive);
     [[nodiscard]] bool isAlive() const;
 
+    // --- Registry access ---
+    [[nodiscard]] Engine::EntityId getId() const;
+
+    /// @throws std::runtime_error if the entity was moved from.
+    [[nodiscard]] Engine::Registry& getRegistry() const;
+
+    /// Registry used by entities constructed without one.
+    static Engine::Registry& sharedRegistry();
+
 protected:
-    sf::Vector2f m_position{0.f, 0.f};
-    sf::Vector2f m_velocity{0.f, 0.f};
-    sf::Vector2f m_size{0.f, 0.f};
+    /// Direct access to the components for subclasses (formerly the
+    /// m_position / m_velocity / m_size members). References are
+    /// invalidated when a component of the same type is added to the
+    /// registry, so do not keep them across frames.
+    /// @throws std::runtime_error if the entity was moved from.
+    [[nodiscard]] sf::Vector2f& position();
+    [[nodiscard]] sf::Vector2f& velocity();
+    [[nodiscard]] sf::Vector2f& size();
+
+    Engine::Registry* m_registry = nullptr;
+    Engine::EntityId m_id = Engine::NullEntity;
     bool m_alive = true;
+
+private:
+    /// Get one of the entity's components.
+    /// @throws std::runtime_error if the entity was moved from.
+    template <typename Component>
+    [[nodiscard]] Component& component() const;
+
+    /// Cache the registry's pools (null when there is no registry).
+    void bindPools();
+
+    void release();
+
+    // Pools are heap objects owned by the registry, stable for its
+    // lifetime, so accessors index them without a type lookup
+    Engine::ComponentPool<Engine::Position>* m_positions = nullptr;
+    Engine::ComponentPool<Engine::Velocity>* m_velocities = nullptr;
+    Engine::ComponentPool<Engine::Size>* m_sizes = nullptr;
 };
 
 } // namespace Example
@@ -0,0 +1,330 @@
+#pragma once
+
+#include "Example/Physics/Collision.hpp"
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace Example {
+
+/// Closest hit reported by AABBTree::rayCast() / segmentCast().
+struct RayHit {
+    std::uint32_t proxy = 0;  ///< Proxy that was hit.
+    float distance = 0.f;     ///< Distance from the origin along the (normalized) direction.
+    sf::Vector2f point;       ///< Entry point on the proxy's bounds.
+    sf::Vector2f normal;      ///< Face normal at the entry point ({0, 0} if the ray starts inside).
+};
+
+/// Dynamic bounding volume hierarchy over AABBs.
+///
+/// Suited to mostly static worlds with a few movers: queries, ray casts
+/// and point tests visit O(log n) nodes instead of every object, and
+/// objects can be added, moved and removed at any time.
+///
+/// - Each leaf stores the proxy's exact bounds plus a "fat" copy grown by
+///   a margin (and by the predicted displacement in move()). A mover only
+///   touches the tree when it leaves its fat bounds, so most move() calls
+///   are O(1).
+/// - Nodes live in one vector with a free list (no per-node allocation);
+///   proxy ids are node indices and are reused after remove().
+/// - Insertion picks the sibling by bounding perimeter, then walks back to
+///   the root rotating unbalanced nodes, keeping the height logarithmic.
+///
+/// Queries and casts report results against the exact bounds, using the
+/// same rules as Collision::intersects (strict overlap) and
+/// Collision::contains (min inclusive, max exclusive).
+///
+/// Usage:
+/// @code
+///   auto id = m_tree.add(crate.getBounds(), crateIndex);
+///   m_tree.move(id, player.getBounds(), player.getVelocity() * dt);
+///   m_tree.query(mouseWorld, [&](Example::AABBTree::ProxyId hit) { pick(hit); });
+///   bool visible = m_tree.isSegmentClear(guardEye, playerCentre,
+///       [&](auto id) { return id != guardId; });
+/// @endcode
+///
+/// Query callbacks may return void, or bool (false stops the query). They
+/// must not modify the tree.
+class AABBTree {
+public:
+    using ProxyId = std::uint32_t;
+    static constexpr ProxyId Null = std::numeric_limits<ProxyId>::max();
+
+    /// @param margin How far leaf bounds are fattened on each side (world units).
+    explicit AABBTree(float margin = 4.f);
+
+    /// Add a proxy.
+    /// @param bounds   Exact bounds.
+    /// @param userData Arbitrary value (e.g. an entity index), see getUserData().
+    ProxyId add(const sf::FloatRect& bounds, std::uint32_t userData = 0);
+
+    /// Remove a proxy. Its id may be reused by a later add().
+    void remove(ProxyId id);
+
+    /// Update a proxy's bounds.
+    /// @param displacement Expected movement until the next move(); the
+    ///                     fat bounds are stretched in that direction.
+    /// @return True if the proxy left its fat bounds and was re-inserted.
+    bool move(ProxyId id, const sf::FloatRect& bounds, sf::Vector2f displacement = {0.f, 0.f});
+
+    /// Get a proxy's exact bounds.
+    [[nodiscard]] sf::FloatRect getBounds(ProxyId id) const;
+
+    /// Get a proxy's fattened bounds (as stored in the tree).
+    [[nodiscard]] sf::FloatRect getFatBounds(ProxyId id) const;
+
+    /// Get the value passed to add().
+    [[nodiscard]] std::uint32_t getUserData(ProxyId id) const;
+
+    /// Check whether the id refers to a live proxy.
+    [[nodiscard]] bool isValid(ProxyId id) const;
+
+    /// Get the number of proxies.
+    [[nodiscard]] std::size_t size() const;
+
+    /// Get the height of the tree (0 when empty, 1 for a single proxy).
+    [[nodiscard]] int getHeight() const;
+
+    /// Remove every proxy.
+    void clear();
+
+    /// Call fn(ProxyId) for every proxy whose bounds overlap the region.
+    template <typename Fn>
+    void query(const sf::FloatRect& region, Fn&& fn) const {
+        const Box area = toBox(region);
+        traverse([&](const Box& box) { return overlaps(box, area); },
+                 [&](ProxyId id) {
+                     return !overlaps(m_nodes[id].tight, area) || report(fn, id);
+                 });
+    }
+
+    /// Call fn(ProxyId) for every proxy whose bounds contain the point.
+    template <typename Fn>
+    void query(sf::Vector2f point, Fn&& fn) const {
+        traverse([&](const Box& box) { return contains(box, point); },
+                 [&](ProxyId id) {
+                     return !contains(m_nodes[id].tight, point) || report(fn, id);
+                 });
+    }
+
+    /// Find the closest proxy hit by a ray.
+    /// @param direction   Need not be normalized (must not be zero).
+    /// @param maxDistance Ray length along the normalized direction.
+    [[nodiscard]] std::optional<RayHit> rayCast(sf::Vector2f origin, sf::Vector2f direction,
+                                                float maxDistance) const {
+        return rayCast(origin, direction, maxDistance, [](ProxyId) { return true; });
+    }
+
+    /// Find the closest proxy hit by a ray among those accepted by filter(ProxyId).
+    template <typename Filter>
+    [[nodiscard]] std::optional<RayHit> rayCast(sf::Vector2f origin, sf::Vector2f direction,
+                                                float maxDistance, Filter&& filter) const {
+        return cast(origin, direction, maxDistance, filter, false);
+    }
+
+    /// Find the closest proxy hit by the segment from -> to.
+    [[nodiscard]] std::optional<RayHit> segmentCast(sf::Vector2f from, sf::Vector2f to) const {
+        return segmentCast(from, to, [](ProxyId) { return true; });
+    }
+
+    /// Find the closest proxy hit by the segment among those accepted by filter(ProxyId).
+    template <typename Filter>
+    [[nodiscard]] std::optional<RayHit> segmentCast(sf::Vector2f from, sf::Vector2f to,
+                                                    Filter&& filter) const {
+        const sf::Vector2f delta = to - from;
+        const float length = std::hypot(delta.x, delta.y);
+        if (length == 0.f) return std::nullopt;
+        return cast(from, delta, length, filter, false);
+    }
+
+    /// Check that no proxy blocks the segment (line of sight). Stops at the
+    /// first blocker instead of searching for the closest.
+    [[nodiscard]] bool isSegmentClear(sf::Vector2f from, sf::Vector2f to) const {
+        return isSegmentClear(from, to, [](ProxyId) { return true; });
+    }
+
+    /// Line of sight, ignoring the proxies rejected by filter(ProxyId).
+    template <typename Filter>
+    [[nodiscard]] bool isSegmentClear(sf::Vector2f from, sf::Vector2f to, Filter&& filter) const {
+        const sf::Vector2f delta = to - from;
+        const float length = std::hypot(delta.x, delta.y);
+        if (length == 0.f) return true;
+        return !cast(from, delta, length, filter, true).has_value();
+    }
+
+private:
+    struct Box {
+        float minX, minY, maxX, maxY;
+    };
+
+    struct Node {
+        Box fat{};               ///< Leaf: fattened bounds. Internal: union of the children.
+        Box tight{};             ///< Leaf only: exact bounds.
+        ProxyId parent = Null;   ///< Free node: next free node.
+        ProxyId child1 = Null;
+        ProxyId child2 = Null;
+        std::int32_t height = -1; ///< Leaf 0, free -1.
+        std::uint32_t userData = 0;
+
+        [[nodiscard]] bool isLeaf() const { return child1 == Null; }
+    };
+
+    /// Depth-first stack. An AVL-balanced tree of 2^32 leaves is < 64 deep,
+    /// and the stack never holds more than height + 1 nodes.
+    using Stack = std::array<ProxyId, 64>;
+
+    ProxyId allocateNode();
+    void freeNode(ProxyId id);
+    void insertLeaf(ProxyId leaf);
+    void removeLeaf(ProxyId leaf);
+    ProxyId balance(ProxyId a);
+    [[nodiscard]] const Node& leaf(ProxyId id) const;
+
+    [[nodiscard]] static Box toBox(const sf::FloatRect& rect);
+    [[nodiscard]] static sf::FloatRect toRect(const Box& box);
+    [[nodiscard]] static Box combine(const Box& a, const Box& b);
+    [[nodiscard]] static float perimeter(const Box& box);
+    [[nodiscard]] static bool encloses(const Box& outer, const Box& inner);
+
+    [[nodiscard]] static bool overlaps(const Box& a, const Box& b) {
+        return a.minX < b.maxX && b.minX < a.maxX && a.minY < b.maxY && b.minY < a.maxY;
+    }
+
+    [[nodiscard]] static bool contains(const Box& box, sf::Vector2f point) {
+        return point.x >= box.minX && point.x < box.maxX && point.y >= box.minY && point.y < box.maxY;
+    }
+
+    /// Call fn(id); a void fn always continues.
+    template <typename Fn>
+    static bool report(Fn& fn, ProxyId id) {
+        if constexpr (std::is_void_v<std::invoke_result_t<Fn&, ProxyId>>) {
+            fn(id);
+            return true;
+        } else {
+            return static_cast<bool>(fn(id));
+        }
+    }
+
+    /// Visit the leaves under every node whose fat box passes `descend`;
+    /// `visit(leaf)` returns false to stop.
+    template <typename Descend, typename Visit>
+    void traverse(Descend&& descend, Visit&& visit) const {
+        if (m_root == Null) return;
+        Stack stack;
+        std::size_t top = 0;
+        stack[top++] = m_root;
+        while (top > 0) {
+            const ProxyId id = stack[--top];
+            const Node& node = m_nodes[id];
+            if (!descend(node.fat)) continue;
+            if (node.isLeaf()) {
+                if (!visit(id)) return;
+            } else {
+                stack[top++] = node.child1;
+                stack[top++] = node.child2;
+            }
+        }
+    }
+
+    /// Slab test. Returns the entry distance in [0, maxDistance] (0 when
+    /// starting inside) and the entry face's normal, or nothing on a miss.
+    [[nodiscard]] static std::optional<float> intersectRay(const Box& box, sf::Vector2f origin,
+                                                           sf::Vector2f inverse, float maxDistance,
+                                                           sf::Vector2f* normal = nullptr) {
+        const float tx1 = (box.minX - origin.x) * inverse.x;
+        const float tx2 = (box.maxX - origin.x) * inverse.x;
+        const float ty1 = (box.minY - origin.y) * inverse.y;
+        const float ty2 = (box.maxY - origin.y) * inverse.y;
+
+        const float enterX = std::min(tx1, tx2);
+        const float enterY = std::min(ty1, ty2);
+        const float enter = std::max(enterX, enterY);
+        const float exit = std::min(std::max(tx1, tx2), std::max(ty1, ty2));
+        if (exit <= enter || exit <= 0.f || enter > maxDistance) return std::nullopt;
+
+        if (enter <= 0.f) {
+            if (normal) *normal = {0.f, 0.f};
+            return 0.f;
+        }
+        if (normal) {
+            *normal = enterX > enterY ? sf::Vector2f(inverse.x > 0.f ? -1.f : 1.f, 0.f)
+                                      : sf::Vector2f(0.f, inverse.y > 0.f ? -1.f : 1.f);
+        }
+        return enter;
+    }
+
+    template <typename Filter>
+    [[nodiscard]] std::optional<RayHit> cast(sf::Vector2f origin, sf::Vector2f direction,
+                                             float maxDistance, Filter& filter, bool anyHit) const {
+        const float length = std::hypot(direction.x, direction.y);
+        if (length == 0.f || m_root == Null) return std::nullopt;
+        const sf::Vector2f unit = direction / length;
+        // A huge finite inverse for axis-parallel rays keeps the slab test
+        // free of 0 * inf = NaN
+        constexpr float huge = std::numeric_limits<float>::max();
+        const sf::Vector2f inverse{unit.x != 0.f ? 1.f / unit.x : huge,
+                                   unit.y != 0.f ? 1.f / unit.y : huge};
+
+        std::optional<RayHit> best;
+        float limit = maxDistance;
+
+        const auto rootEnter = intersectRay(m_nodes[m_root].fat, origin, inverse, limit);
+        if (!rootEnter) return std::nullopt;
+
+        // Nodes are pushed with their entry distance; ones entered beyond
+        // the closest hit found since cannot improve it
+        struct Pending {
+            ProxyId id;
+            float enter;
+        };
+        std::array<Pending, std::tuple_size_v<Stack>> stack;
+        std::size_t top = 0;
+        stack[top++] = {m_root, *rootEnter};
+        while (top > 0) {
+            const Pending pending = stack[--top];
+            if (pending.enter > limit) continue;
+            const Node& node = m_nodes[pending.id];
+
+            if (!node.isLeaf()) {
+                // Visit the child the ray enters first first: finding a close
+                // hit early prunes the rest of the tree
+                const auto enter1 = intersectRay(m_nodes[node.child1].fat, origin, inverse, limit);
+                const auto enter2 = intersectRay(m_nodes[node.child2].fat, origin, inverse, limit);
+                if (enter1 && enter2) {
+                    const bool firstIsNearer = *enter1 <= *enter2;
+                    stack[top++] = firstIsNearer ? Pending{node.child2, *enter2} : Pending{node.child1, *enter1};
+                    stack[top++] = firstIsNearer ? Pending{node.child1, *enter1} : Pending{node.child2, *enter2};
+                } else if (enter1) {
+                    stack[top++] = {node.child1, *enter1};
+                } else if (enter2) {
+                    stack[top++] = {node.child2, *enter2};
+                }
+                continue;
+            }
+
+            sf::Vector2f normal;
+            const auto distance = intersectRay(node.tight, origin, inverse, limit, &normal);
+            if (!distance || !filter(pending.id)) continue;
+
+            best = RayHit{pending.id, *distance, origin + unit * *distance, normal};
+            if (anyHit) break;
+            limit = *distance;
+        }
+        return best;
+    }
+
+    float m_margin;
+    std::vector<Node> m_nodes;
+    ProxyId m_root = Null;
+    ProxyId m_freeList = Null;
+    std::size_t m_proxyCount = 0;
+};
+
+} // namespace Example
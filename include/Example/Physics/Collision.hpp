@@ -1,6 +1,11 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
 
 namespace Example {
 
@@ -10,6 +15,108 @@ struct CollisionResult {
     sf::Vector2f overlap{0.f, 0.f}; ///< Minimum translation vector to resolve.
 };
 
+/// Result of sweeping a moving AABB against a static one.
+struct SweepResult {
+    bool hit = false;                  ///< Whether contact happens during the move.
+    float time = 1.f;                  ///< Fraction of the displacement travelled before contact, in [0, 1].
+    sf::Vector2f normal{0.f, 0.f};     ///< Obstacle face normal at contact (points toward the mover).
+    sf::Vector2f position{0.f, 0.f};   ///< Mover's position (top-left) at contact, or at the end.
+    sf::Vector2f remaining{0.f, 0.f};  ///< Displacement left after contact ((1 - time) * displacement).
+};
+
+/// Candidate pair reported by a broadphase (proxy indices, a < b).
+struct CollisionPair {
+    std::uint32_t a = 0;
+    std::uint32_t b = 0;
+};
+
+/// Collision layers of an object: the layers it belongs to (category
+/// bits) and the layers it collides with (mask bits). Broadphases pair two
+/// objects only if each one's category is in the other's mask, so the
+/// filtered-out pairs never reach the narrowphase.
+///
+/// @code
+///   enum Layer : std::uint32_t { Player = 1, Enemy = 2, Bullet = 4, Pickup = 8 };
+///   CollisionFilter bullet{Bullet, Player | Enemy};   // bullets ignore bullets
+///   CollisionFilter pickup{Pickup, Player};           // pickups only hit the player
+/// @endcode
+struct CollisionFilter {
+    std::uint32_t category = 1;           ///< Layers the object is in.
+    std::uint32_t mask = 0xFFFFFFFFu;     ///< Layers it collides with.
+
+    /// Check whether two objects may collide (the test is symmetric).
+    [[nodiscard]] bool accepts(const CollisionFilter& other) const {
+        return (category & other.mask) != 0 && (other.category & mask) != 0;
+    }
+};
+
+/// Candidate pair counts per collision layer, from a broadphase, to tune
+/// layer layouts (which layers produce most of the narrowphase work).
+struct LayerPairStats {
+    static constexpr std::size_t LayerCount = 32;
+
+    /// Per category bit: pairs with at least one object in that layer.
+    /// A pair spanning two layers counts once in each.
+    std::array<std::uint32_t, LayerCount> pairs{};
+    std::uint32_t total = 0;     ///< Pairs reported.
+    std::uint32_t filtered = 0;  ///< Overlapping pairs dropped by their filters.
+
+    /// Reset every count to zero.
+    void clear();
+
+    /// Count one reported pair.
+    void record(const CollisionFilter& a, const CollisionFilter& b);
+};
+
+/// Many rects stored as structure-of-arrays (centres and half-extents),
+/// for testing one rect against all of them with SIMD.
+///
+/// Centres and half-extents are computed once in add() / set(), with the
+/// same operations Collision::checkAABB() performs on every call.
+class AABBBatch {
+public:
+    AABBBatch() = default;
+
+    /// Append a rect.
+    /// @return Its index.
+    std::size_t add(const sf::FloatRect& rect);
+
+    /// Replace the rect at an index.
+    void set(std::size_t index, const sf::FloatRect& rect);
+
+    /// Remove every rect (storage is kept).
+    void clear();
+
+    /// Pre-allocate room for `count` rects.
+    void reserve(std::size_t count);
+
+    /// Get the number of rects.
+    [[nodiscard]] std::size_t size() const;
+
+    [[nodiscard]] const float* centerX() const { return m_centerX.data(); }
+    [[nodiscard]] const float* centerY() const { return m_centerY.data(); }
+    [[nodiscard]] const float* halfWidth() const { return m_halfWidth.data(); }
+    [[nodiscard]] const float* halfHeight() const { return m_halfHeight.data(); }
+
+private:
+    std::vector<float> m_centerX;
+    std::vector<float> m_centerY;
+    std::vector<float> m_halfWidth;
+    std::vector<float> m_halfHeight;
+};
+
+/// Result of checking one rect against an AABBBatch.
+struct BatchCollisionResult {
+    std::vector<std::uint64_t> hits;     ///< Bit i (word i / 64) set when rect i overlaps.
+    std::vector<sf::Vector2f> overlaps;  ///< Per rect: the checkAABB() overlap, zero when apart.
+    std::size_t count = 0;               ///< Number of set bits in `hits`.
+
+    /// Check whether rect `index` of the batch overlaps.
+    [[nodiscard]] bool isColliding(std::size_t index) const {
+        return (hits[index / 64] >> (index % 64)) & 1u;
+    }
+};
+
 /// Axis-Aligned Bounding Box collision utilities.
 ///
 /// Provides detection and resolution for rectangular entities.
@@ -24,6 +131,59 @@ namespace Collision {
     /// @return CollisionResult with overlap data.
     CollisionResult checkAABB(const sf::FloatRect& a, const sf::FloatRect& b);
 
+    /// Check one rectangle against every rect of a batch, four at a time
+    /// with SSE2 (scalar on other CPUs).
+    ///
+    /// Bit-identical to calling checkAABB(a, rect) for each rect: same
+    /// operations in the same order, same axis choice on ties (y), same
+    /// signs, and NaN extents count as colliding just like the scalar test.
+    /// checkAABB() stays the reference implementation.
+    /// @param a     Bounding box tested against the batch.
+    /// @param batch Rects to test.
+    /// @param out   Receives the hit mask and overlaps (resized to the batch).
+    void checkAABB(const sf::FloatRect& a, const AABBBatch& batch, BatchCollisionResult& out);
+
+    /// Continuous (swept) AABB test: find when a rect moving by
+    /// `displacement` during one step first touches a static obstacle, so
+    /// fast movers cannot tunnel through thin walls between fixed ticks.
+    ///
+    /// Rects that already overlap report a hit at time 0 with the normal of
+    /// checkAABB()'s resolution axis while the displacement points into the
+    /// obstacle (against the normal); moving out or along the face is not a
+    /// hit, so overlapping bodies can separate. Touching without moving
+    /// inward is not a hit either, consistent with checkAABB(). Equal entry times on both axes
+    /// (a corner) resolve along y, as checkAABB() does on ties.
+    ///
+    /// To resolve, move to `position`, then cancel the velocity along
+    /// `normal` and optionally sweep again with the slid remainder:
+    /// `remaining - normal * (remaining.x * normal.x + remaining.y * normal.y)`.
+    /// @param moving       Mover's bounds at the start of the step.
+    /// @param displacement Movement during the step (velocity * dt).
+    /// @param obstacle     Static bounds (for two movers, pass the relative displacement).
+    /// @return SweepResult; time = 1 and hit = false when nothing is touched.
+    SweepResult sweepAABB(const sf::FloatRect& moving, sf::Vector2f displacement,
+                          const sf::FloatRect& obstacle);
+
+    /// Earliest contact against several obstacles (e.g. broadphase candidates).
+    /// @param hitIndex Receives the index of the obstacle hit first, if any.
+    SweepResult sweepAABB(const sf::FloatRect& moving, sf::Vector2f displacement,
+                          std::span<const sf::FloatRect> obstacles, std::size_t* hitIndex = nullptr);
+
+    /// Bounds covering a rect over its whole move. Query a broadphase
+    /// (SpatialHash, AABBTree) with this to get the obstacles worth sweeping:
+    /// @code
+    ///   // Only fast movers pay for CCD; slow ones cannot skip a wall
+    ///   if (std::abs(d.x) > bounds.size.x / 2.f || std::abs(d.y) > bounds.size.y / 2.f) {
+    ///       m_candidates.clear();
+    ///       m_tree.query(Collision::sweptBounds(bounds, d), [&](auto id) {
+    ///           m_candidates.push_back(m_tree.getBounds(id));
+    ///       });
+    ///       auto sweep = Collision::sweepAABB(bounds, d, m_candidates);
+    ///       ...
+    ///   }
+    /// @endcode
+    sf::FloatRect sweptBounds(const sf::FloatRect& rect, sf::Vector2f displacement);
+
     /// Simple boolean overlap check (faster if you don't need resolution).
     /// @param a First bounding box.
     /// @param b Second bounding box.
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "Engine/ECS/ComponentPool.hpp"
+#include "Engine/Event/EventBus.hpp"
+#include "Example/Physics/Collision.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace Example {
+
+/// Contact state of an entity pair, kept across ticks.
+/// `a` has the lower entity index; `result.overlap` points from a toward b.
+struct ContactManifold {
+    Engine::EntityId a;
+    Engine::EntityId b;
+    sf::FloatRect boundsA;      ///< Bounds the result was computed from.
+    sf::FloatRect boundsB;
+    CollisionResult result;     ///< Collision::checkAABB(boundsA, boundsB).
+};
+
+/// Published when two entities start overlapping.
+struct ContactBegin {
+    Engine::EntityId a;
+    Engine::EntityId b;
+    sf::Vector2f overlap;       ///< From a toward b (push a by -overlap to resolve).
+};
+
+/// Published when an ongoing contact's overlap changes (not every tick:
+/// a resting contact whose bounds do not move stays silent).
+struct ContactStay {
+    Engine::EntityId a;
+    Engine::EntityId b;
+    sf::Vector2f overlap;
+};
+
+/// Published when two entities stop overlapping, are no longer reported
+/// by the broadphase, or one of them is removed.
+struct ContactEnd {
+    Engine::EntityId a;
+    Engine::EntityId b;
+};
+
+/// Persistent narrowphase cache keyed by entity pair.
+///
+/// Collision::checkAABB() is stateless; this keeps each pair's manifold
+/// between ticks so that:
+/// - a new contact can be told from an ongoing one: ContactBegin,
+///   ContactStay and ContactEnd go through the Engine::EventBus only when
+///   the contact state changes, not once per tick per pair;
+/// - a pair whose two bounds are exactly the same as last tick (resting
+///   or sleeping objects) reuses its cached result and skips checkAABB().
+///
+/// Feed it the candidate pairs of a broadphase every fixed tick:
+/// @code
+///   m_contacts.beginStep();
+///   for (const auto& pair : m_hash.pairs()) {
+///       m_contacts.update(ids[pair.a], m_hash.getBounds(pair.a),
+///                         ids[pair.b], m_hash.getBounds(pair.b));
+///   }
+///   m_contacts.endStep();               // publishes ContactEnd for pairs not seen
+///
+///   for (const auto& contact : m_contacts.getContacts()) {
+///       if (contact.result.colliding) resolve(contact);
+///   }
+/// @endcode
+///
+/// Pairs a broadphase reports without overlapping (e.g. AABBTree fat
+/// bounds) are cached too, so they also skip checkAABB() while still.
+/// Entities are compared with their generation, so a recycled id is a new
+/// contact. Handlers may call remove() but not update() / endStep().
+class ContactCache {
+public:
+    /// @param events Bus the contact events are published on.
+    explicit ContactCache(Engine::EventBus& events);
+
+    // Non-copyable, movable
+    ContactCache(const ContactCache&) = delete;
+    ContactCache& operator=(const ContactCache&) = delete;
+    ContactCache(ContactCache&&) = default;
+    ContactCache& operator=(ContactCache&&) = default;
+
+    /// Start a tick: every cached pair is marked unseen.
+    void beginStep();
+
+    /// Report a candidate pair for this tick and get its collision result
+    /// (overlap from a toward b, in the order passed).
+    /// Runs the narrowphase only if either bounds changed since the pair's
+    /// last update, and publishes ContactBegin / ContactStay on changes.
+    CollisionResult update(Engine::EntityId a, const sf::FloatRect& boundsA,
+                           Engine::EntityId b, const sf::FloatRect& boundsB);
+
+    /// End a tick: pairs not updated since beginStep() are dropped, and
+    /// ContactEnd is published for those that were overlapping.
+    void endStep();
+
+    /// Drop every pair involving an entity (e.g. when it is destroyed),
+    /// publishing ContactEnd for its overlapping ones.
+    void remove(Engine::EntityId entity);
+
+    /// Get a pair's manifold, or nullptr if the pair is not cached.
+    [[nodiscard]] const ContactManifold* find(Engine::EntityId a, Engine::EntityId b) const;
+
+    /// Check whether two entities overlapped as of their last update.
+    [[nodiscard]] bool isTouching(Engine::EntityId a, Engine::EntityId b) const;
+
+    /// Every cached pair, overlapping or not (unordered).
+    [[nodiscard]] std::span<const ContactManifold> getContacts() const;
+
+    /// Narrowphase tests run since the last beginStep().
+    [[nodiscard]] std::size_t getTestedCount() const;
+
+    /// Pairs that reused their cached result since the last beginStep().
+    [[nodiscard]] std::size_t getSkippedCount() const;
+
+    /// Get the number of cached pairs.
+    [[nodiscard]] std::size_t size() const;
+
+    /// Drop every pair without publishing anything.
+    void clear();
+
+private:
+    [[nodiscard]] static std::uint64_t pairKey(Engine::EntityId a, Engine::EntityId b);
+    void erase(std::size_t index);
+    void publishEnded();
+
+    Engine::EventBus* m_events;
+    std::vector<ContactManifold> m_contacts;               ///< Dense pair storage.
+    std::vector<bool> m_seen;                              ///< Per m_contacts entry: updated this tick.
+    std::unordered_map<std::uint64_t, std::uint32_t> m_index; ///< Pair key -> m_contacts index.
+    std::vector<ContactEnd> m_ended;                       ///< endStep() / remove(): events to publish.
+    std::size_t m_tested = 0;
+    std::size_t m_skipped = 0;
+};
+
+} // namespace Example
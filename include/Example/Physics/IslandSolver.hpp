@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Engine/Core/ThreadPool.hpp"
+#include "Example/Physics/Collision.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Example {
+
+/// Contact resolution split into independent islands, solved in parallel.
+///
+/// Bodies connected through contact pairs form an island (found with
+/// union-find). Static bodies (inverse mass 0) do not connect islands, so
+/// separate piles resting on the same floor stay separate. Islands share
+/// no dynamic body, so each one is solved on its own thread without locks.
+///
+/// Within an island, pairs are relaxed in their input order for a fixed
+/// number of iterations: each overlapping pair is pushed apart along
+/// Collision::checkAABB()'s minimum translation vector, split by inverse
+/// mass. The work done for an island never depends on which thread runs
+/// it or on other islands, so results are bit-identical whatever the
+/// number of threads (including no pool at all).
+///
+/// Usage (every fixed tick, after the broadphase):
+/// @code
+///   m_hash.clear();
+///   m_hash.insertBounds(m_bounds);
+///   m_solver.solve(m_bounds, m_inverseMasses, m_hash.pairs());
+///   // m_bounds now holds the separated positions
+/// @endcode
+class IslandSolver {
+public:
+    /// @param pool Threads to solve islands on (nullptr = the calling thread).
+    ///             Must outlive the solver.
+    explicit IslandSolver(Engine::ThreadPool* pool = nullptr);
+
+    /// Set the thread pool (nullptr = the calling thread).
+    void setThreadPool(Engine::ThreadPool* pool);
+
+    /// Set how many times each island's pairs are relaxed per solve().
+    /// More iterations settle tall piles better. Default 4.
+    void setIterations(int iterations);
+    [[nodiscard]] int getIterations() const;
+
+    /// Push overlapping bodies apart.
+    /// @param bounds        Per body, updated in place.
+    /// @param inverseMasses Per body; 0 for static bodies, which never move.
+    /// @param pairs         Candidate pairs (e.g. SpatialHash::pairs()), indices into bounds.
+    void solve(std::span<sf::FloatRect> bounds, std::span<const float> inverseMasses,
+               std::span<const CollisionPair> pairs);
+
+    /// Number of islands in the last solve().
+    [[nodiscard]] std::size_t getIslandCount() const;
+
+    /// Pairs in the largest island of the last solve().
+    [[nodiscard]] std::size_t getLargestIslandSize() const;
+
+private:
+    [[nodiscard]] std::uint32_t find(std::uint32_t body);
+    void unite(std::uint32_t a, std::uint32_t b);
+
+    /// Relax one island's pairs.
+    void solveIsland(std::size_t island, std::span<sf::FloatRect> bounds,
+                     std::span<const float> inverseMasses, std::span<const CollisionPair> pairs) const;
+
+    Engine::ThreadPool* m_pool;
+    int m_iterations = 4;
+
+    std::vector<std::uint32_t> m_parent;       ///< Union-find forest over bodies.
+    std::vector<std::uint32_t> m_islandOfRoot; ///< Per root body: island index, or None.
+    std::vector<std::uint32_t> m_pairIsland;   ///< Per pair: island index, or None.
+    std::vector<std::uint32_t> m_islandStart;  ///< Island count + 1 offsets into m_islandPairs.
+    std::vector<std::uint32_t> m_islandPairs;  ///< Pair indices grouped by island, in input order.
+    std::vector<std::uint32_t> m_schedule;     ///< Island indices, largest first.
+    std::vector<std::uint32_t> m_batchStart;   ///< Batch count + 1 offsets into m_schedule.
+};
+
+} // namespace Example
@@ -0,0 +1,214 @@
+#pragma once
+
+#include "Example/Physics/Collision.hpp"
+#include <SFML/Graphics.hpp>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Example {
+
+/// Uniform-grid broadphase: finds the AABB pairs that may overlap without
+/// testing every pair.
+///
+/// Every tick, clear() the hash, insert() the bounds of all objects, then
+/// ask for candidate pairs or for the objects in a region. Objects are
+/// identified by their insertion index (0, 1, 2, ...). Only pairs whose
+/// rects actually overlap are reported, each exactly once, so they can go
+/// straight to Collision::checkAABB.
+///
+/// The grid is infinite: when the occupied area is compact its cells are
+/// indexed directly, otherwise they are hashed into a table sized to the
+/// number of objects, so the world needs no bounds. All storage is kept
+/// between ticks; after the first few ticks clear() + insert() + pairs()
+/// allocate nothing.
+///
+/// Objects can be given a CollisionFilter, through insert() or the
+/// insertBounds() overloads taking a filter projection or a parallel range
+/// of filters: pairs whose layers do not collide are dropped inside the
+/// pair loop and never reported. getLayerStats() counts the reported pairs
+/// per layer.
+///
+/// Choose a cell size around the size of a typical object: much smaller
+/// and each object spans many cells, much larger and each cell holds many
+/// objects.
+///
+/// Usage:
+/// @code
+///   m_hash.clear();
+///   m_hash.insertBounds(m_enemies);         // index i = m_enemies[i]
+///   for (const auto& pair : m_hash.pairs()) {
+///       auto result = Collision::checkAABB(m_enemies[pair.a]->getBounds(),
+///                                          m_enemies[pair.b]->getBounds());
+///       ...
+///   }
+/// @endcode
+///
+/// With layers, give each element a filter:
+/// @code
+///   m_hash.insertBounds(m_bodies, m_filters);      // m_filters[i] for m_bodies[i]
+///   m_hash.insertBounds(m_bodies, &Body::filter);  // or a projection
+/// @endcode
+class SpatialHash {
+public:
+    /// @param cellSize Edge length of a grid cell in world units.
+    explicit SpatialHash(float cellSize = 64.f);
+
+    /// Set the cell size. Takes effect at the next pairs() / query().
+    void setCellSize(float cellSize);
+    [[nodiscard]] float getCellSize() const;
+
+    /// Remove every object (storage is kept).
+    void clear();
+
+    /// Pre-allocate room for `count` objects.
+    void reserve(std::size_t count);
+
+    /// Insert an object (at most 2^30 objects).
+    /// @param bounds Its bounds.
+    /// @param filter Its collision layers (default: layer 1, collides with all).
+    /// @return Its index (the number of objects inserted before it).
+    std::uint32_t insert(const sf::FloatRect& bounds, const CollisionFilter& filter = {});
+
+    /// Insert the bounds of every element of a range: rects, entities
+    /// (anything with getBounds()), or pointers / smart pointers to them.
+    /// All of them get the default filter.
+    template <typename Range>
+    void insertBounds(const Range& range) {
+        for (const auto& element : range) {
+            insert(boundsOf(element));
+        }
+    }
+
+    /// Insert the bounds of every element of a range, each with the filter
+    /// a projection gives for it: a callable or a member pointer taking the
+    /// element as stored (e.g. `&Enemy::filter` for a vector of enemies).
+    template <typename Range, typename FilterOf>
+        requires std::invocable<const FilterOf&, std::ranges::range_reference_t<const Range>>
+    void insertBounds(const Range& range, const FilterOf& filterOf) {
+        for (const auto& element : range) {
+            insert(boundsOf(element), std::invoke(filterOf, element));
+        }
+    }
+
+    /// Insert the bounds of every element of a range, element i with
+    /// filters[i].
+    /// @throws std::runtime_error if the ranges differ in length (nothing is inserted).
+    template <typename Range, std::ranges::forward_range Filters>
+        requires std::convertible_to<std::ranges::range_reference_t<const Filters>, CollisionFilter>
+    void insertBounds(const Range& range, const Filters& filters) {
+        const auto count = std::ranges::distance(range);
+        if (count != std::ranges::distance(filters)) {
+            throw std::runtime_error("SpatialHash: Filter count mismatch -> "
+                                     + std::to_string(std::ranges::distance(filters)));
+        }
+        auto filter = std::ranges::begin(filters);
+        for (const auto& element : range) {
+            insert(boundsOf(element), *filter);
+            ++filter;
+        }
+    }
+
+    /// Get every pair of inserted objects whose bounds overlap and whose
+    /// filters accept each other, each once, with a < b.
+    /// Valid until the next clear() / insert().
+    std::span<const CollisionPair> pairs();
+
+    /// Collect the indices of the objects overlapping a region, each once.
+    /// @param region Area to search.
+    /// @param out    Receives the indices (cleared first).
+    /// @param mask   Only objects with a category bit in the mask are collected.
+    void query(const sf::FloatRect& region, std::vector<std::uint32_t>& out,
+               std::uint32_t mask = 0xFFFFFFFFu);
+
+    /// Per-layer counts of the pairs reported by the last pairs() call,
+    /// and of the overlapping pairs its filters dropped.
+    [[nodiscard]] const LayerPairStats& getLayerStats() const;
+
+    /// Get the bounds of an inserted object.
+    [[nodiscard]] sf::FloatRect getBounds(std::uint32_t index) const;
+
+    /// Get the number of inserted objects.
+    [[nodiscard]] std::size_t size() const;
+
+private:
+    template <typename Element>
+    static sf::FloatRect boundsOf(const Element& element) {
+        if constexpr (std::is_convertible_v<Element, sf::FloatRect>) {
+            return element;
+        } else if constexpr (requires { element.getBounds(); }) {
+            return element.getBounds();
+        } else {
+            return element->getBounds();
+        }
+    }
+
+    struct Box {
+        float minX, minY, maxX, maxY;
+    };
+
+    struct CellRange {
+        std::int32_t x0, y0, x1, y1;
+    };
+
+    /// One object in one cell. The box is copied in so the pair and query
+    /// loops read buckets sequentially instead of chasing object indices.
+    struct Entry {
+        Box box;
+        std::uint32_t key; ///< Object index, plus StartsColumn / StartsRow flags.
+    };
+
+    /// Entry::key flag: the cell is in the object's first column of cells.
+    static constexpr std::uint32_t StartsColumn = 1u << 31;
+    /// Entry::key flag: the cell is in the object's first row of cells.
+    static constexpr std::uint32_t StartsRow = 1u << 30;
+    static constexpr std::uint32_t IndexMask = StartsRow - 1;
+
+    /// Fill the buckets from the inserted objects (once per change).
+    void build();
+
+    /// Fill m_ranges and m_extent from m_boxes.
+    void computeRanges();
+
+    /// The pair loop, specialised on whether buckets can hold several cells
+    /// and whether any object has a non-default filter.
+    template <bool Hashed, bool Filtered>
+    std::size_t collectPairs(std::size_t& filtered);
+
+    [[nodiscard]] std::int32_t cellCoord(float value) const;
+    [[nodiscard]] std::uint32_t bucketOf(std::int32_t cx, std::int32_t cy) const;
+    [[nodiscard]] static std::uint64_t packCell(std::int32_t cx, std::int32_t cy);
+
+    /// Whether a range is at most 2x2 cells.
+    [[nodiscard]] static bool isSmall(const CellRange& range);
+
+    float m_cellSize;
+    float m_inverseCellSize;
+
+    std::vector<Box> m_boxes;                 ///< Per object.
+    std::vector<CollisionFilter> m_filters;   ///< Per object.
+    std::vector<CellRange> m_ranges;          ///< Per object: covered cells.
+    std::vector<std::uint32_t> m_bucketStart; ///< Table size + 1 offsets into m_entries.
+    std::vector<Entry> m_entries;             ///< (object, cell) entries grouped by bucket.
+    std::vector<std::uint64_t> m_entryCells;  ///< Per entry, hash mode only: packed cell.
+    std::vector<CollisionFilter> m_entryFilters; ///< Per entry, only if m_hasFilters.
+    std::vector<CollisionPair> m_pairs;       ///< Sized to capacity; the first m_pairCount are valid.
+    std::size_t m_pairCount = 0;
+    LayerPairStats m_stats;
+    CellRange m_extent{};                     ///< Cells covered by any object.
+    bool m_dense = false;                     ///< Buckets index m_extent directly.
+    bool m_hasFilters = false;                ///< Some object has a non-default filter.
+    std::uint32_t m_gridWidth = 0;            ///< Dense mode: cells per row.
+    std::uint32_t m_bucketMask = 0;           ///< Hash mode: table size - 1.
+    bool m_built = false;
+    bool m_pairsValid = false;
+};
+
+} // namespace Example
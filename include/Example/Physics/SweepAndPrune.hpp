@@ -0,0 +1,163 @@
+#pragma once
+
+#include "Example/Physics/Collision.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace Example {
+
+/// Incremental sweep-and-prune broadphase.
+///
+/// Keeps the min/max endpoints of every proxy sorted along x and y across
+/// ticks. Objects move only a little per fixed tick, so the lists are
+/// nearly sorted and an insertion sort fixes them in close to O(n); every
+/// swap of a min past a max is exactly one pair starting or stopping to
+/// overlap on that axis. The broadphase therefore reports what changed
+/// (getAddedPairs() / getRemovedPairs()) instead of rebuilding a full pair
+/// list, and keeps the set of overlapping pairs (getPairs()) up to date.
+///
+/// Prefer SpatialHash when most objects teleport or move far every tick;
+/// prefer this one when motion is coherent and you care about contact
+/// begin / end.
+///
+/// Usage:
+/// @code
+///   auto id = m_sap.add(entity.getBounds());     // once
+///   m_sap.update(id, entity.getBounds());        // every tick, for movers
+///   m_sap.step();
+///   for (const auto& pair : m_sap.getAddedPairs())   onBegin(pair);
+///   for (const auto& pair : m_sap.getRemovedPairs()) onEnd(pair);
+///   for (const auto& pair : m_sap.getPairs()) {
+///       auto result = m_sap.check(pair);           // Collision::checkAABB
+///       ...
+///   }
+/// @endcode
+///
+/// Many proxies added at once (e.g. loading a level) would make the
+/// insertion sort quadratic, so that step() sorts and sweeps from scratch
+/// instead, still reporting only the differences.
+///
+/// Proxies can be given a CollisionFilter: overlaps between layers that
+/// do not collide never become pairs, so they are neither reported nor
+/// kept. getLayerStats() counts the current pairs per layer.
+///
+/// Pairs hold proxy ids with a < b. Ids of removed proxies are reused.
+class SweepAndPrune {
+public:
+    using ProxyId = std::uint32_t;
+
+    SweepAndPrune() = default;
+
+    /// Add a proxy. Its pairs are reported by the next step().
+    /// @param bounds Its bounds.
+    /// @param filter Its collision layers (default: layer 1, collides with all).
+    ProxyId add(const sf::FloatRect& bounds, const CollisionFilter& filter = {});
+
+    /// Remove a proxy. Its pairs are reported as removed by the next step().
+    void remove(ProxyId id);
+
+    /// Set a proxy's bounds. Takes effect at the next step().
+    void update(ProxyId id, const sf::FloatRect& bounds);
+
+    /// Change a proxy's collision layers. The next step() re-evaluates
+    /// every pair, reporting the ones the change added or removed.
+    void setFilter(ProxyId id, const CollisionFilter& filter);
+
+    /// Get a proxy's collision layers.
+    [[nodiscard]] const CollisionFilter& getFilter(ProxyId id) const;
+
+    /// Re-sort the endpoints and compute this tick's pair changes.
+    void step();
+
+    /// Pairs that started overlapping during the last step().
+    [[nodiscard]] std::span<const CollisionPair> getAddedPairs() const;
+
+    /// Pairs that stopped overlapping (or lost a proxy) during the last step().
+    [[nodiscard]] std::span<const CollisionPair> getRemovedPairs() const;
+
+    /// Every pair overlapping as of the last step() (unordered).
+    [[nodiscard]] std::span<const CollisionPair> getPairs() const;
+
+    /// Per-layer counts of the pairs overlapping as of the last step();
+    /// `filtered` counts the overlaps its filters dropped during that step.
+    [[nodiscard]] const LayerPairStats& getLayerStats() const;
+
+    /// Check whether two proxies overlapped as of the last step().
+    [[nodiscard]] bool isOverlapping(ProxyId a, ProxyId b) const;
+
+    /// Narrowphase for a reported pair (Collision::checkAABB on the current bounds).
+    [[nodiscard]] CollisionResult check(const CollisionPair& pair) const;
+
+    /// Get a proxy's current bounds.
+    [[nodiscard]] sf::FloatRect getBounds(ProxyId id) const;
+
+    /// Check whether the id refers to a live proxy.
+    [[nodiscard]] bool isValid(ProxyId id) const;
+
+    /// Get the number of live proxies.
+    [[nodiscard]] std::size_t size() const;
+
+    /// Remove every proxy and pair (without reporting them).
+    void clear();
+
+private:
+    static constexpr std::uint32_t MaxFlag = 0x80000000u;
+    static constexpr std::uint32_t FlatFlag = 0x40000000u; ///< The proxy has no extent on the axis.
+
+    struct Proxy {
+        float min[2];
+        float max[2];
+        CollisionFilter filter;
+        bool live = false;
+        bool removed = false; ///< remove() was called; purged by the next step().
+    };
+
+    /// One end of a proxy's interval on one axis.
+    struct Endpoint {
+        float value;
+        std::uint32_t data; ///< Proxy id, | MaxFlag for a max endpoint, | FlatFlag.
+
+        [[nodiscard]] ProxyId proxy() const { return data & ~(MaxFlag | FlatFlag); }
+        [[nodiscard]] bool isMax() const { return (data & MaxFlag) != 0; }
+
+        /// Order among endpoints of equal value: maxes, then flat proxies
+        /// (by id, min before max), then mins.
+        [[nodiscard]] std::uint64_t tieOrder() const {
+            if (data & FlatFlag) return (std::uint64_t{1} << 32) | (std::uint64_t{proxy()} << 1) | isMax();
+            return isMax() ? 0 : std::uint64_t{2} << 32;
+        }
+    };
+
+    void refreshValues(int axis);
+    void sortAxis(int axis);
+    void rebuild();
+    void purgeRemoved();
+    [[nodiscard]] bool overlaps(ProxyId a, ProxyId b) const;
+    void addPairIfAccepted(ProxyId a, ProxyId b);
+    void addPair(ProxyId a, ProxyId b);
+    void removePair(ProxyId a, ProxyId b);
+    [[nodiscard]] static std::uint64_t pairKey(ProxyId a, ProxyId b);
+
+    std::vector<Proxy> m_proxies;
+    std::vector<ProxyId> m_freeIds;
+    std::vector<Endpoint> m_endpoints[2];  ///< Sorted along x and y.
+    std::size_t m_liveCount = 0;
+    std::size_t m_addedSinceStep = 0;
+    bool m_hasRemovals = false;
+    bool m_filtersChanged = false;
+
+    std::vector<CollisionPair> m_pairs;                    ///< Current overlaps (dense).
+    std::unordered_map<std::uint64_t, std::uint32_t> m_pairIndex; ///< Pair key -> m_pairs index.
+    std::vector<CollisionPair> m_added;
+    std::vector<CollisionPair> m_removed;
+    LayerPairStats m_stats;
+    std::vector<ProxyId> m_active;          ///< rebuild(): proxies open along x.
+    std::vector<CollisionPair> m_found;     ///< rebuild(): overlaps found.
+    std::vector<bool> m_kept;               ///< rebuild(): m_pairs entries still overlapping.
+};
+
+} // namespace Example
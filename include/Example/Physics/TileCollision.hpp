@@ -0,0 +1,108 @@
+#pragma once
+
+#include "Example/Physics/Collision.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace Example {
+
+/// Collision shape of one tile cell.
+enum class TileShape : std::uint8_t {
+    Empty,        ///< Passable.
+    Solid,        ///< Blocks from every side.
+    OneWay,       ///< Blocks only movers falling onto its top (jump-through platform).
+    SlopeUpRight, ///< 45 degree floor rising left to right ( / ); passable from the sides and below.
+    SlopeUpLeft   ///< 45 degree floor rising right to left ( \ ); passable from the sides and below.
+};
+
+/// Static collision against a tile grid.
+///
+/// Level geometry lives on a grid, so the only collision candidates of a
+/// moving rect are the cells under it: resolve() walks just the cells
+/// the rect's leading edge sweeps over, stopping at the first one that
+/// blocks, so its cost depends on the distance moved and the rect size,
+/// never on the map size. Each cell is one byte.
+///
+/// Movement is resolved one axis at a time (x, then y), which keeps
+/// sliding along walls and floors exact; a mover then rests on a slope by
+/// its uphill bottom corner. A mover walking along the floor steps over a
+/// solid lip no higher than its horizontal move (a 45 degree climb), so
+/// ramps lead onto flat ground without snagging.
+///
+/// Usage (platformer):
+/// @code
+///   TileCollision level({200, 40}, {16.f, 16.f});
+///   level.setTile({10, 30}, TileShape::Solid);
+///
+///   // Fixed update
+///   auto result = level.resolve(player.getBounds(), velocity * dt);
+///   player.move(velocity * dt - result.overlap);
+///   if (result.overlap.y > 0.f) { onGround = true; velocity.y = 0.f; }
+///   if (result.overlap.x != 0.f) velocity.x = 0.f;
+/// @endcode
+///
+/// Align it with an Engine::TileMap by giving both the same tile size and
+/// position. Cells outside the map are empty.
+class TileCollision {
+public:
+    /// @param mapSize  Map size in cells.
+    /// @param tileSize Cell size in world units.
+    TileCollision(sf::Vector2u mapSize, sf::Vector2f tileSize);
+
+    /// Set the shape of a cell. Out-of-range cells are ignored.
+    void setTile(sf::Vector2u cell, TileShape shape);
+
+    /// Get the shape of a cell (Empty if out of range).
+    [[nodiscard]] TileShape getTile(sf::Vector2u cell) const;
+
+    /// Set every cell to the same shape.
+    void fill(TileShape shape);
+
+    /// Move a rect by a displacement, stopping at the cells in the way.
+    /// @param bounds       Rect at the start of the move.
+    /// @param displacement Desired movement (velocity * dt).
+    /// @return CollisionResult whose overlap is how much of the move was
+    ///         cancelled: the rect ends at bounds.position + displacement - overlap.
+    ///         overlap.y > 0 means it landed on something, overlap.x != 0
+    ///         that it hit a wall. colliding is true when anything blocked.
+    [[nodiscard]] CollisionResult resolve(const sf::FloatRect& bounds, sf::Vector2f displacement) const;
+
+    /// Check whether a rect overlaps any Solid cell (e.g. before spawning).
+    [[nodiscard]] bool overlapsSolid(const sf::FloatRect& bounds) const;
+
+    /// Get the cell containing a world point (may be out of range).
+    [[nodiscard]] sf::Vector2i cellAt(sf::Vector2f point) const;
+
+    /// Set the world position of the grid's top-left corner.
+    void setPosition(sf::Vector2f position);
+    [[nodiscard]] sf::Vector2f getPosition() const;
+
+    [[nodiscard]] sf::Vector2u getMapSize() const;
+    [[nodiscard]] sf::Vector2f getTileSize() const;
+
+private:
+    /// Shape of a cell given as signed coordinates (Empty if out of range).
+    [[nodiscard]] TileShape at(int x, int y) const;
+
+    /// Move along x; returns the new left edge (local coordinates).
+    /// May lift `position` onto a low lip when `canStep`.
+    [[nodiscard]] float sweepX(sf::Vector2f& position, sf::Vector2f size, float dx, bool canStep) const;
+
+    /// Move along y; returns the new top edge (local coordinates).
+    [[nodiscard]] float sweepY(sf::Vector2f position, sf::Vector2f size, float dy) const;
+
+    /// Lift a rect whose bottom sank below a slope's surface onto it.
+    [[nodiscard]] float restOnSlopes(sf::Vector2f position, sf::Vector2f size) const;
+
+    /// Highest slope surface (smallest y) in a row under a rect spanning
+    /// [x, x + width], taken at its uphill bottom corner; infinity if none.
+    [[nodiscard]] float slopeSurface(int row, float x, float width) const;
+
+    sf::Vector2u m_mapSize;
+    sf::Vector2f m_tileSize;
+    sf::Vector2f m_position{0.f, 0.f};
+    std::vector<TileShape> m_cells; ///< Row-major, m_mapSize.x * m_mapSize.y.
+};
+
+} // namespace Example
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Example/UI/HUD.hpp"
+#include "Engine/Graphics/RenderStats.hpp"
+#include <SFML/Graphics.hpp>
+
+namespace Example {
+
+/// Screen-space overlay showing the renderer's per-frame counters.
+///
+/// Each line shows the last frame's value followed by the average and
+/// peak over the recorder's history, so spikes and regressions stand out
+/// while the game runs. The text is rebuilt a few times per second rather
+/// than every frame so it stays readable. The overlay's own text and
+/// background are included in the counters it shows.
+///
+/// Usage:
+/// @code
+///   Example::RenderStatsHUD stats(ctx.renderStats, font);
+///   // Each frame:
+///   stats.update(dt);
+///   ctx.renderer.setView(ctx.renderer.getDefaultView());
+///   stats.draw(ctx.renderer);
+/// @endcode
+class RenderStatsHUD : public HUD {
+public:
+    /// @param stats Recorder to read from (usually Context::renderStats).
+    /// @param font  Font for the overlay text. Must outlive the HUD.
+    RenderStatsHUD(const Engine::RenderStatsRecorder& stats, const sf::Font& font);
+    ~RenderStatsHUD() override = default;
+
+    void update(float dt) override;
+    void draw(Engine::Renderer& renderer) override;
+
+    /// Set how often the text is rebuilt, in seconds (default 0.25).
+    void setRefreshInterval(float seconds);
+
+private:
+    void rebuildText();
+
+    const Engine::RenderStatsRecorder& m_stats;
+    sf::Text m_text;
+    sf::RectangleShape m_background;
+
+    float m_refreshInterval = 0.25f;
+    float m_sinceRefresh = 0.f;
+    bool m_dirty = true;
+};
+
+} // namespace Example
@@ -0,0 +1,241 @@
+#include "Engine/Assets/TextureAtlas.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace Engine {
+
+TextureAtlas::TextureAtlas(sf::Vector2u pageSize, unsigned int padding)
+    : m_pageSize(pageSize), m_padding(padding) {
+}
+
+void TextureAtlas::add(const std::string& id, const std::filesystem::path& filename) {
+    if (m_images.find(id) != m_images.end()) {
+        return;
+    }
+
+    sf::Image image;
+    if (!image.loadFromFile(filename)) {
+        throw std::runtime_error(
+            "TextureAtlas: Failed to load '" + filename.string() + "'");
+    }
+
+    add(id, image);
+}
+
+void TextureAtlas::add(const std::string& id, const sf::Image& image) {
+    if (m_images.find(id) != m_images.end()) {
+        return;
+    }
+
+    if (image.getSize().x == 0 || image.getSize().y == 0) {
+        throw std::runtime_error("TextureAtlas: Empty image -> " + id);
+    }
+
+    m_images.emplace(id, image);
+}
+
+void TextureAtlas::build() {
+    m_regions.clear();
+    m_pages.clear();
+    m_report = {};
+
+    // Deterministic order: tallest first, then widest, then by id
+    std::vector<const std::string*> order;
+    order.reserve(m_images.size());
+    for (const auto& [id, image] : m_images) {
+        order.push_back(&id);
+    }
+    std::sort(order.begin(), order.end(), [this](const std::string* a, const std::string* b) {
+        const sf::Vector2u sa = m_images.at(*a).getSize();
+        const sf::Vector2u sb = m_images.at(*b).getSize();
+        if (sa.y != sb.y) return sa.y > sb.y;
+        if (sa.x != sb.x) return sa.x > sb.x;
+        return *a < *b;
+    });
+
+    std::vector<Page> pages;
+
+    for (const std::string* id : order) {
+        const sf::Image& image = m_images.at(*id);
+        const sf::Vector2u size = image.getSize();
+
+        if (size.x > m_pageSize.x || size.y > m_pageSize.y) {
+            throw std::runtime_error(
+                "TextureAtlas: Image larger than atlas page -> " + *id);
+        }
+
+        // Padding goes to the right/bottom; an image that exactly fills a page needs none
+        const sf::Vector2u padded{std::min(size.x + m_padding, m_pageSize.x),
+                                  std::min(size.y + m_padding, m_pageSize.y)};
+
+        sf::Vector2u position;
+        std::size_t pageIndex = 0;
+        while (pageIndex < pages.size() && !insert(pages[pageIndex], padded, position)) {
+            ++pageIndex;
+        }
+
+        if (pageIndex == pages.size()) {
+            Page& page = pages.emplace_back();
+            page.skyline.push_back({0, 0, m_pageSize.x});
+            page.image.resize(m_pageSize, sf::Color::Transparent);
+            insert(page, padded, position); // Always fits an empty page
+        }
+
+        Page& page = pages[pageIndex];
+        if (!page.image.copy(image, position)) {
+            throw std::runtime_error("TextureAtlas: Failed to copy image -> " + *id);
+        }
+        page.usedPixels += static_cast<std::uint64_t>(size.x) * size.y;
+
+        AtlasRegion region;
+        region.page = pageIndex;
+        region.rect = sf::IntRect({static_cast<int>(position.x), static_cast<int>(position.y)},
+                                  {static_cast<int>(size.x), static_cast<int>(size.y)});
+        m_regions.emplace(*id, region);
+    }
+
+    // Upload pages; the CPU-side page images are released afterwards
+    const std::uint64_t pageArea = static_cast<std::uint64_t>(m_pageSize.x) * m_pageSize.y;
+    for (const Page& page : pages) {
+        auto texture = std::make_unique<sf::Texture>();
+        if (!texture->loadFromImage(page.image)) {
+            throw std::runtime_error("TextureAtlas: Failed to create page texture");
+        }
+        m_pages.push_back(std::move(texture));
+
+        m_report.usedPixels += page.usedPixels;
+        m_report.pageOccupancy.push_back(
+            100.f * static_cast<float>(page.usedPixels) / static_cast<float>(pageArea));
+    }
+
+    for (auto& [id, region] : m_regions) {
+        region.texture = m_pages[region.page].get();
+    }
+
+    m_report.pageCount = m_pages.size();
+    m_report.imageCount = m_regions.size();
+    m_report.totalPixels = pageArea * m_pages.size();
+    if (m_report.totalPixels > 0) {
+        m_report.occupancy = 100.f * static_cast<float>(m_report.usedPixels)
+                                   / static_cast<float>(m_report.totalPixels);
+    }
+}
+
+const AtlasRegion& TextureAtlas::get(const std::string& id) const {
+    auto it = m_regions.find(id);
+    if (it == m_regions.end()) {
+        throw std::runtime_error("TextureAtlas: Region not found -> " + id);
+    }
+    return it->second;
+}
+
+bool TextureAtlas::has(const std::string& id) const {
+    return m_regions.find(id) != m_regions.end();
+}
+
+const sf::Texture& TextureAtlas::getPage(std::size_t index) const {
+    if (index >= m_pages.size()) {
+        throw std::runtime_error("TextureAtlas: Page index out of range");
+    }
+    return *m_pages[index];
+}
+
+std::size_t TextureAtlas::getPageCount() const {
+    return m_pages.size();
+}
+
+sf::Vector2u TextureAtlas::getPageSize() const {
+    return m_pageSize;
+}
+
+const AtlasReport& TextureAtlas::getReport() const {
+    return m_report;
+}
+
+void TextureAtlas::clear() {
+    m_images.clear();
+    m_regions.clear();
+    m_pages.clear();
+    m_report = {};
+}
+
+bool TextureAtlas::fit(const Page& page, std::size_t index, sf::Vector2u size, unsigned int& y) const {
+    const SkylineNode& start = page.skyline[index];
+    if (start.x + size.x > m_pageSize.x) {
+        return false;
+    }
+
+    // The rectangle rests on the highest segment it spans
+    y = start.y;
+    unsigned int widthLeft = size.x;
+    for (std::size_t i = index; widthLeft > 0; ++i) {
+        if (i == page.skyline.size()) {
+            return false;
+        }
+        y = std::max(y, page.skyline[i].y);
+        if (y + size.y > m_pageSize.y) {
+            return false;
+        }
+        widthLeft -= std::min(widthLeft, page.skyline[i].width);
+    }
+    return true;
+}
+
+bool TextureAtlas::insert(Page& page, sf::Vector2u size, sf::Vector2u& position) const {
+    // Bottom-left rule: lowest resting height, then leftmost
+    std::size_t bestIndex = page.skyline.size();
+    unsigned int bestY = std::numeric_limits<unsigned int>::max();
+
+    for (std::size_t i = 0; i < page.skyline.size(); ++i) {
+        unsigned int y = 0;
+        if (fit(page, i, size, y) && y < bestY) {
+            bestY = y;
+            bestIndex = i;
+        }
+    }
+
+    if (bestIndex == page.skyline.size()) {
+        return false;
+    }
+
+    position = {page.skyline[bestIndex].x, bestY};
+
+    // Raise the skyline under the new rectangle
+    const SkylineNode node{position.x, bestY + size.y, size.x};
+    page.skyline.insert(page.skyline.begin() + static_cast<std::ptrdiff_t>(bestIndex), node);
+
+    for (std::size_t i = bestIndex + 1; i < page.skyline.size();) {
+        const SkylineNode& previous = page.skyline[i - 1];
+        SkylineNode& current = page.skyline[i];
+        const unsigned int previousEnd = previous.x + previous.width;
+
+        if (current.x >= previousEnd) {
+            break;
+        }
+
+        const unsigned int shrink = previousEnd - current.x;
+        if (current.width <= shrink) {
+            page.skyline.erase(page.skyline.begin() + static_cast<std::ptrdiff_t>(i));
+            continue;
+        }
+
+        current.x += shrink;
+        current.width -= shrink;
+        break;
+    }
+
+    // Merge neighbouring segments at the same height
+    for (std::size_t i = 0; i + 1 < page.skyline.size();) {
+        if (page.skyline[i].y == page.skyline[i + 1].y) {
+            page.skyline[i].width += page.skyline[i + 1].width;
+            page.skyline.erase(page.skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+        } else {
+            ++i;
+        }
+    }
+
+    return true;
+}
+
+} // namespace Engine
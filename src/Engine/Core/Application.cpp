@@ -2,11 +2,13 @@
 
 namespace Engine {
 
-Application::Application(unsigned int width, unsigned int height, const std::string& title)
-    : m_renderer(width, height, title)
-    , m_context{m_renderer, m_input, m_audio, m_scenes, m_events, {}, {}, {}}
+Application::Application(unsigned int width, unsigned int height, const std::string& title,
+                         FramePacing pacing, RenderMode mode)
+    : m_renderer(width, height, title, mode)
+    , m_pacer(m_renderer, pacing)
+    , m_context{m_renderer, m_input, m_audio, m_scenes, m_events, m_pacer,
+                m_renderer.getRenderStats(), m_interpolation, {}, {}, {}, {}}
 {
-    m_renderer.setFramerateLimit(60);
 }
 
 void Application::run() {
@@ -17,12 +19,6 @@ void Application::run() {
     m_scenes.processSceneChanges();
 
     while (m_renderer.isOpen() && !m_scenes.empty()) {
-        // 1. Apply pending scene changes (e.g., menu -> gameplay)
-        m_scenes.processSceneChanges();
-
-        // If all scenes were popped during processing, exit
-        if (m_scenes.empty()) break;
-
         // Fixed timestep accumulation
         float newTime = m_clock.getElapsedTime().asSeconds();
         float frameTime = newTime - currentTime;
@@ -34,32 +30,76 @@ void Application::run() {
         currentTime = newTime;
         accumulator += frameTime;
 
-        // 2. Poll window events through InputManager
-        m_input.pollEvents(m_renderer);
-
-        // Handle window close request
-        if (m_input.isWindowCloseRequested()) {
-            m_renderer.close();
-            continue;
-        }
-
-        // 3. Handle scene input
-        m_scenes.getActiveScene()->handleInput(dt);
-
-        // 4. Fixed-rate logic updates
-        while (accumulator >= dt) {
-            m_scenes.getActiveScene()->update(dt);
-            accumulator -= dt;
-        }
-
-        // 5. Render with interpolation
-        float interpolation = accumulator / dt;
-        m_renderer.clear();
-        m_scenes.getActiveScene()->draw(interpolation);
-        m_renderer.display();
+        step(accumulator);
     }
 }
 
+std::size_t Application::runFrames(std::size_t frameCount) {
+    float accumulator = 0.0f;
+    std::size_t frames = 0;
+
+    m_scenes.processSceneChanges();
+
+    while (frames < frameCount && m_renderer.isOpen() && !m_scenes.empty()) {
+        // Exactly one fixed update per frame, independent of wall-clock time,
+        // so the same frame count always produces the same frames
+        accumulator += dt;
+        step(accumulator);
+        ++frames;
+    }
+
+    return frames;
+}
+
+void Application::step(float& accumulator) {
+    // 1. Apply pending scene changes (e.g., menu -> gameplay)
+    m_scenes.processSceneChanges();
+
+    // If all scenes were popped during processing, exit
+    if (m_scenes.empty()) return;
+
+    // 2. Poll window events through InputManager
+    m_input.pollEvents(m_renderer);
+
+    // Handle window close request
+    if (m_input.isWindowCloseRequested()) {
+        m_renderer.close();
+        return;
+    }
+
+    // 3. Handle scene input
+    m_scenes.getActiveScene()->handleInput(dt);
+
+    // 4. Fixed-rate logic updates, then the scene's behaviour coroutines.
+    //    The render transforms of the previous tick are kept for blending.
+    while (accumulator >= dt) {
+        Scene& scene = *m_scenes.getActiveScene();
+        m_interpolation.snapshot();
+        scene.update(dt);
+        scene.scheduler().tick(dt);
+        accumulator -= dt;
+    }
+
+    // 5. Render with interpolation: blend every registered transform in one
+    //    pass, so scenes just draw at InterpolationBuffer::getPosition()
+    float interpolation = accumulator / dt;
+    m_interpolation.blend(interpolation);
+    m_renderer.clear();
+    m_scenes.getActiveScene()->draw(interpolation);
+    m_renderer.display();
+
+    // 6. Pace the frame (vsync, uncapped or precise target rate)
+    m_pacer.wait();
+}
+
+void Application::setFramePacing(FramePacing pacing) {
+    m_pacer.setPacing(pacing);
+}
+
+FrameTimeStats Application::getFrameTimeStats() const {
+    return m_pacer.getStats();
+}
+
 Context& Application::context() {
     return m_context;
 }
@@ -0,0 +1,106 @@
+#include "Engine/Core/FramePacer.hpp"
+#include "Engine/Graphics/Renderer.hpp"
+#include <SFML/System.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace Engine {
+
+FramePacer::FramePacer(Renderer& renderer, FramePacing pacing)
+    : m_renderer(renderer), m_pacing(pacing) {
+    apply();
+}
+
+void FramePacer::setPacing(FramePacing pacing) {
+    m_pacing = pacing;
+    m_started = false; // Restart the deadline sequence at the new rate
+    apply();
+}
+
+const FramePacing& FramePacer::getPacing() const {
+    return m_pacing;
+}
+
+void FramePacer::apply() {
+    m_renderer.setFramerateLimit(0);
+    m_renderer.setVerticalSyncEnabled(m_pacing.mode == PresentMode::VSync);
+}
+
+void FramePacer::wait() {
+    Clock::time_point now = Clock::now();
+
+    if (m_pacing.mode == PresentMode::Precise && m_pacing.targetRate > 0) {
+        const auto period = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(1.0 / m_pacing.targetRate));
+
+        if (!m_started) {
+            m_deadline = now + period;
+        } else {
+            m_deadline += period;
+            // Fell more than a frame behind (hitch, breakpoint): resync instead of racing
+            if (now > m_deadline + period) {
+                m_deadline = now + period;
+            }
+        }
+
+        const auto remaining = m_deadline - now;
+        if (remaining > m_spinThreshold) {
+            const auto sleepFor = std::chrono::duration_cast<std::chrono::microseconds>(
+                remaining - m_spinThreshold);
+            sf::sleep(sf::microseconds(sleepFor.count()));
+        }
+
+        while ((now = Clock::now()) < m_deadline) {
+            // Spin: sleeping here would overshoot by the scheduler granularity
+        }
+    }
+
+    record(now);
+}
+
+FrameTimeStats FramePacer::getStats() const {
+    FrameTimeStats stats;
+    stats.samples = m_historyCount;
+    if (m_historyCount == 0) {
+        return stats;
+    }
+
+    double sum = 0.0;
+    stats.min = m_history[0];
+    stats.max = m_history[0];
+    for (std::size_t i = 0; i < m_historyCount; ++i) {
+        sum += m_history[i];
+        stats.min = std::min(stats.min, m_history[i]);
+        stats.max = std::max(stats.max, m_history[i]);
+    }
+    const double mean = sum / static_cast<double>(m_historyCount);
+
+    double squares = 0.0;
+    for (std::size_t i = 0; i < m_historyCount; ++i) {
+        const double d = m_history[i] - mean;
+        squares += d * d;
+    }
+
+    stats.mean = static_cast<float>(mean);
+    stats.variance = static_cast<float>(squares / static_cast<double>(m_historyCount));
+    stats.standardDeviation = std::sqrt(stats.variance);
+    return stats;
+}
+
+void FramePacer::setSpinThreshold(std::chrono::microseconds threshold) {
+    m_spinThreshold = threshold;
+}
+
+void FramePacer::record(Clock::time_point now) {
+    if (m_started) {
+        const float frameTime = std::chrono::duration<float>(now - m_lastFrame).count();
+        m_history[m_historyNext] = frameTime;
+        m_historyNext = (m_historyNext + 1) % HistorySize;
+        m_historyCount = std::min(m_historyCount + 1, HistorySize);
+    }
+
+    m_lastFrame = now;
+    m_started = true;
+}
+
+} // namespace Engine
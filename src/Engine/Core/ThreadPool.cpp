@@ -0,0 +1,99 @@
+#include "Engine/Core/ThreadPool.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace Engine {
+
+ThreadPool::ThreadPool(unsigned int threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    m_workers.reserve(threadCount - 1);
+    for (unsigned int i = 1; i < threadCount; ++i) {
+        m_workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::parallelFor(std::size_t count, const std::function<void(std::size_t)>& task) {
+    if (count == 0) return;
+    if (m_workers.empty() || count == 1) {
+        for (std::size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_count = count;
+        m_next.store(0, std::memory_order_relaxed);
+        m_error = nullptr;
+        m_active = static_cast<unsigned int>(m_workers.size());
+        ++m_generation;
+    }
+    m_wake.notify_all();
+
+    runTasks();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this] { return m_active == 0; });
+    m_task = nullptr;
+    if (m_error) {
+        std::rethrow_exception(std::exchange(m_error, nullptr));
+    }
+}
+
+unsigned int ThreadPool::getThreadCount() const {
+    return static_cast<unsigned int>(m_workers.size()) + 1;
+}
+
+void ThreadPool::workerLoop() {
+    std::uint64_t seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [&] { return m_stop || m_generation != seen; });
+            if (m_stop) return;
+            seen = m_generation;
+        }
+
+        runTasks();
+
+        bool last = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            last = --m_active == 0;
+        }
+        if (last) {
+            m_done.notify_one();
+        }
+    }
+}
+
+void ThreadPool::runTasks() {
+    while (true) {
+        const std::size_t index = m_next.fetch_add(1, std::memory_order_relaxed);
+        if (index >= m_count) return;
+        try {
+            (*m_task)(index);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_error) m_error = std::current_exception();
+            m_next.store(m_count, std::memory_order_relaxed); // Skip the rest
+        }
+    }
+}
+
+} // namespace Engine
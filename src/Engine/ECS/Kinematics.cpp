@@ -0,0 +1,189 @@
+#include "Engine/ECS/Kinematics.hpp"
+#include "Engine/ECS/Components.hpp"
+#include <algorithm>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define ENGINE_KINEMATICS_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+    #endif
+#else
+    #define ENGINE_KINEMATICS_X86 0
+#endif
+
+#if ENGINE_KINEMATICS_X86 && (defined(__GNUC__) || defined(__clang__))
+    // Compile the AVX path for AVX without raising the baseline of the whole build
+    #define ENGINE_TARGET_AVX __attribute__((target("avx")))
+#else
+    #define ENGINE_TARGET_AVX
+#endif
+
+static_assert(sizeof(Engine::Position) == 2 * sizeof(float)
+              && sizeof(Engine::Velocity) == 2 * sizeof(float),
+              "Kinematics: Position / Velocity must be two packed floats");
+
+namespace Engine {
+
+namespace {
+
+/// Kernel constants, resolved once per call.
+struct Constants {
+    float damping;           ///< Velocity multiplier for this step.
+    float maxSpeed;          ///< +inf when unclamped.
+    float minX, minY;        ///< -inf when unbounded.
+    float maxX, maxY;        ///< +inf when unbounded.
+};
+
+Constants resolve(float dt, const IntegrationParams& params) {
+    constexpr float inf = std::numeric_limits<float>::infinity();
+
+    Constants c{};
+    c.damping = params.damping > 0.f ? std::max(0.f, 1.f - params.damping * dt) : 1.f;
+    c.maxSpeed = params.maxSpeed > 0.f ? params.maxSpeed : inf;
+    if (params.bounds) {
+        c.minX = params.bounds->position.x;
+        c.minY = params.bounds->position.y;
+        c.maxX = params.bounds->position.x + params.bounds->size.x;
+        c.maxY = params.bounds->position.y + params.bounds->size.y;
+    } else {
+        c.minX = c.minY = -inf;
+        c.maxX = c.maxY = inf;
+    }
+    return c;
+}
+
+// Clamp with the exact semantics of maxps / minps, which return their second
+// operand unless the comparison holds: a NaN becomes lo, and of two equal
+// zeros the bound wins. std::min / std::max order their operands the
+// other way and would differ from the vector lanes in both cases.
+inline float clampLane(float v, float lo, float hi) {
+    const float x = v > lo ? v : lo;
+    return x < hi ? x : hi;
+}
+
+void integrateScalar(float* p, float* v, std::size_t first, std::size_t count, float dt,
+                     const Constants& c) {
+    for (std::size_t i = first; i < count; ++i) {
+        float vx = clampLane(v[2 * i] * c.damping, -c.maxSpeed, c.maxSpeed);
+        float vy = clampLane(v[2 * i + 1] * c.damping, -c.maxSpeed, c.maxSpeed);
+        v[2 * i] = vx;
+        v[2 * i + 1] = vy;
+        p[2 * i] = clampLane(p[2 * i] + vx * dt, c.minX, c.maxX);
+        p[2 * i + 1] = clampLane(p[2 * i + 1] + vy * dt, c.minY, c.maxY);
+    }
+}
+
+#if ENGINE_KINEMATICS_X86
+
+/// Two entities per step. Returns the number of entities processed.
+std::size_t integrateSSE2(float* p, float* v, std::size_t count, float dt, const Constants& c) {
+    const __m128 damping = _mm_set1_ps(c.damping);
+    const __m128 maxSpeed = _mm_set1_ps(c.maxSpeed);
+    const __m128 minSpeed = _mm_set1_ps(-c.maxSpeed);
+    const __m128 step = _mm_set1_ps(dt);
+    const __m128 lo = _mm_setr_ps(c.minX, c.minY, c.minX, c.minY);
+    const __m128 hi = _mm_setr_ps(c.maxX, c.maxY, c.maxX, c.maxY);
+
+    const std::size_t end = count & ~std::size_t{1};
+    for (std::size_t i = 0; i < end; i += 2) {
+        __m128 vel = _mm_mul_ps(_mm_loadu_ps(v + 2 * i), damping);
+        vel = _mm_min_ps(_mm_max_ps(vel, minSpeed), maxSpeed);
+        _mm_storeu_ps(v + 2 * i, vel);
+
+        __m128 pos = _mm_add_ps(_mm_loadu_ps(p + 2 * i), _mm_mul_ps(vel, step));
+        pos = _mm_min_ps(_mm_max_ps(pos, lo), hi);
+        _mm_storeu_ps(p + 2 * i, pos);
+    }
+    return end;
+}
+
+/// Four entities per step. Returns the number of entities processed.
+ENGINE_TARGET_AVX
+std::size_t integrateAVX(float* p, float* v, std::size_t count, float dt, const Constants& c) {
+    const __m256 damping = _mm256_set1_ps(c.damping);
+    const __m256 maxSpeed = _mm256_set1_ps(c.maxSpeed);
+    const __m256 minSpeed = _mm256_set1_ps(-c.maxSpeed);
+    const __m256 step = _mm256_set1_ps(dt);
+    const __m256 lo = _mm256_setr_ps(c.minX, c.minY, c.minX, c.minY, c.minX, c.minY, c.minX, c.minY);
+    const __m256 hi = _mm256_setr_ps(c.maxX, c.maxY, c.maxX, c.maxY, c.maxX, c.maxY, c.maxX, c.maxY);
+
+    const std::size_t end = count & ~std::size_t{3};
+    for (std::size_t i = 0; i < end; i += 4) {
+        __m256 vel = _mm256_mul_ps(_mm256_loadu_ps(v + 2 * i), damping);
+        vel = _mm256_min_ps(_mm256_max_ps(vel, minSpeed), maxSpeed);
+        _mm256_storeu_ps(v + 2 * i, vel);
+
+        __m256 pos = _mm256_add_ps(_mm256_loadu_ps(p + 2 * i), _mm256_mul_ps(vel, step));
+        pos = _mm256_min_ps(_mm256_max_ps(pos, lo), hi);
+        _mm256_storeu_ps(p + 2 * i, pos);
+    }
+    // Avoid the AVX-SSE transition penalty in whatever runs next
+    _mm256_zeroupper();
+    return end;
+}
+
+bool cpuSupportsAVX() {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx");
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    const bool osSavesYmm = (info[2] & (1 << 27)) != 0             // OSXSAVE
+                         && (_xgetbv(0) & 0x6) == 0x6;              // XMM + YMM state
+    return osSavesYmm && (info[2] & (1 << 28)) != 0;               // AVX
+#else
+    return false;
+#endif
+}
+
+#endif // ENGINE_KINEMATICS_X86
+
+} // namespace
+
+SimdLevel detectSimdLevel() {
+#if ENGINE_KINEMATICS_X86
+    static const SimdLevel level = cpuSupportsAVX() ? SimdLevel::AVX : SimdLevel::SSE2;
+    return level;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+void integrate(float* positions, float* velocities, std::size_t count, float dt,
+               const IntegrationParams& params, SimdLevel level) {
+    const Constants c = resolve(dt, params);
+    level = std::min(level, detectSimdLevel());
+
+    std::size_t done = 0;
+#if ENGINE_KINEMATICS_X86
+    if (level == SimdLevel::AVX) {
+        done = integrateAVX(positions, velocities, count, dt, c);
+    } else if (level == SimdLevel::SSE2) {
+        done = integrateSSE2(positions, velocities, count, dt, c);
+    }
+#endif
+    // Scalar path, or the tail the vector loop could not fill
+    integrateScalar(positions, velocities, done, count, dt, c);
+}
+
+void integrate(float* positions, float* velocities, std::size_t count, float dt,
+               const IntegrationParams& params) {
+    integrate(positions, velocities, count, dt, params, detectSimdLevel());
+}
+
+std::size_t integrate(Registry& registry, float dt, const IntegrationParams& params) {
+    const std::size_t count = registry.group<Position, Velocity>();
+    if (count == 0) return 0;
+
+    // Position / Velocity are a single sf::Vector2f each, so the dense arrays
+    // are plain interleaved (x, y) float arrays
+    integrate(&registry.storage<Position>().data()->value.x,
+              &registry.storage<Velocity>().data()->value.x,
+              count, dt, params);
+    return count;
+}
+
+} // namespace Engine
@@ -0,0 +1,85 @@
+#include "Engine/ECS/Registry.hpp"
+
+namespace Engine {
+
+namespace detail {
+
+std::size_t nextComponentTypeIndex() {
+    static std::size_t next = 0;
+    return next++;
+}
+
+} // namespace detail
+
+EntityId Registry::create() {
+    std::uint32_t index;
+    if (m_freeHead != EntityId::InvalidIndex) {
+        index = m_freeHead;
+        m_freeHead = m_slots[index].nextFree;
+    } else {
+        if (m_slots.size() >= EntityId::InvalidIndex) {
+            throw std::runtime_error("Registry: Entity slots exhausted");
+        }
+        index = static_cast<std::uint32_t>(m_slots.size());
+        m_slots.emplace_back();
+    }
+
+    Slot& slot = m_slots[index];
+    slot.live = true;
+    slot.nextFree = EntityId::InvalidIndex;
+    ++m_aliveCount;
+    return EntityId{index, slot.generation};
+}
+
+void Registry::destroy(EntityId entity) {
+    if (!isValid(entity)) return;
+
+    for (auto& pool : m_pools) {
+        if (pool) {
+            pool->remove(entity);
+        }
+    }
+
+    // Bump the generation so every copy of this id becomes stale
+    Slot& slot = m_slots[entity.index];
+    ++slot.generation;
+    slot.live = false;
+    slot.nextFree = m_freeHead;
+    m_freeHead = entity.index;
+    --m_aliveCount;
+}
+
+bool Registry::isValid(EntityId entity) const {
+    return entity.index < m_slots.size()
+        && m_slots[entity.index].live
+        && m_slots[entity.index].generation == entity.generation;
+}
+
+void Registry::reserve(std::size_t capacity) {
+    m_slots.reserve(capacity);
+}
+
+std::size_t Registry::size() const {
+    return m_aliveCount;
+}
+
+void Registry::clear() {
+    for (auto& pool : m_pools) {
+        if (pool) {
+            pool->clear();
+        }
+    }
+
+    // Retire every live slot so outstanding ids become stale
+    for (std::uint32_t i = 0; i < m_slots.size(); ++i) {
+        Slot& slot = m_slots[i];
+        if (!slot.live) continue;
+        ++slot.generation;
+        slot.live = false;
+        slot.nextFree = m_freeHead;
+        m_freeHead = i;
+    }
+    m_aliveCount = 0;
+}
+
+} // namespace Engine
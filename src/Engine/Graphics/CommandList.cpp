@@ -0,0 +1,114 @@
+#include "Engine/Graphics/CommandList.hpp"
+#include <stdexcept>
+
+namespace Engine {
+
+void CommandList::clear(sf::Color color) {
+    Command command;
+    command.kind = Kind::Clear;
+    command.color = color;
+    m_commands.push_back(command);
+}
+
+void CommandList::setView(const sf::View& view) {
+    Command command;
+    command.kind = Kind::SetView;
+    command.index = m_views.size();
+    m_views.push_back(view);
+    m_commands.push_back(command);
+}
+
+void CommandList::draw(const sf::Drawable& drawable, const sf::RenderStates& states) {
+    // Vertex arrays are flattened into the shared vertex pool
+    if (const auto* array = dynamic_cast<const sf::VertexArray*>(&drawable)) {
+        if (array->getVertexCount() > 0) {
+            draw(&(*array)[0], array->getVertexCount(), array->getPrimitiveType(), states);
+        }
+        return;
+    }
+
+    Command command;
+    command.kind = Kind::Object;
+    command.states = states;
+    command.index = m_objects.size();
+
+    if (const auto* sprite = dynamic_cast<const sf::Sprite*>(&drawable)) {
+        m_objects.emplace_back(*sprite);
+    } else if (const auto* text = dynamic_cast<const sf::Text*>(&drawable)) {
+        m_objects.emplace_back(*text);
+    } else if (const auto* circle = dynamic_cast<const sf::CircleShape*>(&drawable)) {
+        m_objects.emplace_back(*circle);
+    } else if (const auto* rectangle = dynamic_cast<const sf::RectangleShape*>(&drawable)) {
+        m_objects.emplace_back(*rectangle);
+    } else if (const auto* convex = dynamic_cast<const sf::ConvexShape*>(&drawable)) {
+        m_objects.emplace_back(*convex);
+    } else {
+        throw std::runtime_error(
+            "CommandList: Drawable type cannot be recorded (draw it as vertices instead)");
+    }
+
+    m_commands.push_back(command);
+}
+
+void CommandList::draw(const sf::Vertex* vertices, std::size_t vertexCount,
+                       sf::PrimitiveType type, const sf::RenderStates& states) {
+    Command command;
+    command.kind = Kind::Vertices;
+    command.states = states;
+    command.index = m_vertices.size();
+    command.count = vertexCount;
+    command.primitive = type;
+    m_vertices.insert(m_vertices.end(), vertices, vertices + vertexCount);
+    m_commands.push_back(command);
+}
+
+void CommandList::draw(const sf::VertexBuffer& buffer, std::size_t firstVertex, std::size_t vertexCount,
+                       const sf::RenderStates& states) {
+    Command command;
+    command.kind = Kind::Buffer;
+    command.states = states;
+    command.buffer = &buffer;
+    command.index = firstVertex;
+    command.count = vertexCount;
+    m_commands.push_back(command);
+}
+
+void CommandList::replay(sf::RenderTarget& target) const {
+    for (const Command& command : m_commands) {
+        switch (command.kind) {
+            case Kind::Clear:
+                target.clear(command.color);
+                break;
+            case Kind::SetView:
+                target.setView(m_views[command.index]);
+                break;
+            case Kind::Vertices:
+                target.draw(&m_vertices[command.index], command.count, command.primitive, command.states);
+                break;
+            case Kind::Buffer:
+                target.draw(*command.buffer, command.index, command.count, command.states);
+                break;
+            case Kind::Object:
+                std::visit([&](const auto& object) { target.draw(object, command.states); },
+                           m_objects[command.index]);
+                break;
+        }
+    }
+}
+
+void CommandList::reset() {
+    m_commands.clear();
+    m_vertices.clear();
+    m_views.clear();
+    m_objects.clear();
+}
+
+bool CommandList::empty() const {
+    return m_commands.empty();
+}
+
+std::size_t CommandList::size() const {
+    return m_commands.size();
+}
+
+} // namespace Engine
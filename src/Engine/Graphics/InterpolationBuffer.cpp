@@ -0,0 +1,165 @@
+#include "Engine/Graphics/InterpolationBuffer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define ENGINE_INTERPOLATION_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define ENGINE_INTERPOLATION_SSE2 0
+#endif
+
+namespace Engine {
+
+namespace {
+
+/// out = prev + (curr - prev) * alpha over `count` floats.
+/// SSE2 is part of the x86-64 baseline, so no runtime dispatch is needed;
+/// the pass is bound by memory bandwidth, not arithmetic. The scalar tail
+/// uses the same operation order, so every lane gets the same result.
+void lerp(const float* prev, const float* curr, float* out, std::size_t count, float alpha) {
+    std::size_t i = 0;
+#if ENGINE_INTERPOLATION_SSE2
+    const __m128 a = _mm_set1_ps(alpha);
+    const std::size_t end = count & ~std::size_t{3};
+    for (; i < end; i += 4) {
+        const __m128 p = _mm_loadu_ps(prev + i);
+        const __m128 c = _mm_loadu_ps(curr + i);
+        _mm_storeu_ps(out + i, _mm_add_ps(p, _mm_mul_ps(_mm_sub_ps(c, p), a)));
+    }
+#endif
+    for (; i < count; ++i) {
+        out[i] = prev[i] + (curr[i] - prev[i]) * alpha;
+    }
+}
+
+/// Wrap degrees into [0, 360).
+float wrapDegrees(float degrees) {
+    return degrees - 360.f * std::floor(degrees / 360.f);
+}
+
+} // namespace
+
+InterpolationBuffer::Handle InterpolationBuffer::add(sf::Vector2f position, sf::Angle rotation) {
+    std::uint32_t slotIndex;
+    if (m_freeHead != Npos) {
+        slotIndex = m_freeHead;
+        m_freeHead = m_slots[slotIndex].dense;
+    } else {
+        slotIndex = static_cast<std::uint32_t>(m_slots.size());
+        m_slots.emplace_back();
+    }
+
+    Slot& slot = m_slots[slotIndex];
+    slot.dense = static_cast<std::uint32_t>(m_owners.size());
+    slot.live = true;
+    m_owners.push_back(slotIndex);
+
+    const float state[Channels] = {position.x, position.y, wrapDegrees(rotation.asDegrees())};
+    m_previous.insert(m_previous.end(), state, state + Channels);
+    m_current.insert(m_current.end(), state, state + Channels);
+    m_blended.insert(m_blended.end(), state, state + Channels);
+
+    return Handle{slotIndex, slot.generation};
+}
+
+void InterpolationBuffer::remove(Handle handle) {
+    if (!isValid(handle)) return;
+
+    Slot& slot = m_slots[handle.index];
+    const std::uint32_t dense = slot.dense;
+    const std::uint32_t last = static_cast<std::uint32_t>(m_owners.size() - 1);
+
+    // Swap-pop keeps the arrays packed for blend()
+    if (dense != last) {
+        for (std::vector<float>* channel : {&m_previous, &m_current, &m_blended}) {
+            std::copy_n(channel->begin() + last * Channels, Channels,
+                        channel->begin() + dense * Channels);
+        }
+        m_owners[dense] = m_owners[last];
+        m_slots[m_owners[dense]].dense = dense;
+    }
+    for (std::vector<float>* channel : {&m_previous, &m_current, &m_blended}) {
+        channel->resize(last * Channels);
+    }
+    m_owners.pop_back();
+
+    slot.live = false;
+    ++slot.generation;
+    slot.dense = m_freeHead;
+    m_freeHead = handle.index;
+}
+
+bool InterpolationBuffer::isValid(Handle handle) const {
+    return handle.index < m_slots.size()
+        && m_slots[handle.index].live
+        && m_slots[handle.index].generation == handle.generation;
+}
+
+void InterpolationBuffer::set(Handle handle, sf::Vector2f position, sf::Angle rotation) {
+    const std::size_t i = offset(handle);
+
+    // Store the rotation as previous + shortest delta, so blend() can use a
+    // plain lerp (350 -> 10 turns 20 degrees, not -340). Previous is
+    // re-wrapped by whole turns to keep the values small.
+    const float previous = wrapDegrees(m_previous[i + 2]);
+    float delta = rotation.asDegrees() - previous;
+    delta -= 360.f * std::round(delta / 360.f);
+
+    m_current[i] = position.x;
+    m_current[i + 1] = position.y;
+    m_previous[i + 2] = previous;
+    m_current[i + 2] = previous + delta;
+}
+
+void InterpolationBuffer::teleport(Handle handle, sf::Vector2f position, sf::Angle rotation) {
+    const std::size_t i = offset(handle);
+    const float state[Channels] = {position.x, position.y, wrapDegrees(rotation.asDegrees())};
+    std::copy_n(state, Channels, m_previous.begin() + i);
+    std::copy_n(state, Channels, m_current.begin() + i);
+    std::copy_n(state, Channels, m_blended.begin() + i);
+}
+
+void InterpolationBuffer::snapshot() {
+    std::copy(m_current.begin(), m_current.end(), m_previous.begin());
+}
+
+void InterpolationBuffer::blend(float alpha) {
+    alpha = std::clamp(alpha, 0.f, 1.f);
+    lerp(m_previous.data(), m_current.data(), m_blended.data(), m_blended.size(), alpha);
+}
+
+sf::Vector2f InterpolationBuffer::getPosition(Handle handle) const {
+    const std::size_t i = offset(handle);
+    return {m_blended[i], m_blended[i + 1]};
+}
+
+sf::Angle InterpolationBuffer::getRotation(Handle handle) const {
+    return sf::degrees(m_blended[offset(handle) + 2]);
+}
+
+std::size_t InterpolationBuffer::size() const {
+    return m_owners.size();
+}
+
+void InterpolationBuffer::reserve(std::size_t capacity) {
+    m_previous.reserve(capacity * Channels);
+    m_current.reserve(capacity * Channels);
+    m_blended.reserve(capacity * Channels);
+    m_owners.reserve(capacity);
+    m_slots.reserve(capacity);
+}
+
+std::size_t InterpolationBuffer::offset(Handle handle) const {
+    if (!isValid(handle)) {
+        throw std::runtime_error("InterpolationBuffer: Invalid handle -> "
+                                 + std::to_string(handle.index) + ":"
+                                 + std::to_string(handle.generation));
+    }
+    return std::size_t{m_slots[handle.index].dense} * Channels;
+}
+
+} // namespace Engine
@@ -0,0 +1,241 @@
+#include "Engine/Graphics/RenderQueue.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace Engine {
+
+void RenderQueue::submit(const sf::Texture& texture,
+                         const sf::FloatRect& destination,
+                         const sf::IntRect& textureRect,
+                         DrawOrder order,
+                         sf::Color color,
+                         const sf::BlendMode& blendMode,
+                         const sf::Shader* shader) {
+    const sf::Vector2f min = destination.position;
+    const sf::Vector2f max = destination.position + destination.size;
+    const sf::Vector2f corners[4] = {
+        min, {max.x, min.y}, {min.x, max.y}, max
+    };
+
+    pushQuad(corners, textureRect, color, &texture, order, blendMode, shader);
+}
+
+void RenderQueue::submit(const sf::Sprite& sprite,
+                         DrawOrder order,
+                         const sf::BlendMode& blendMode,
+                         const sf::Shader* shader) {
+    const sf::IntRect& rect = sprite.getTextureRect();
+    const float width  = static_cast<float>(std::abs(rect.size.x));
+    const float height = static_cast<float>(std::abs(rect.size.y));
+
+    const sf::Transform& transform = sprite.getTransform();
+    const sf::Vector2f corners[4] = {
+        transform.transformPoint({0.f, 0.f}),
+        transform.transformPoint({width, 0.f}),
+        transform.transformPoint({0.f, height}),
+        transform.transformPoint({width, height})
+    };
+
+    pushQuad(corners, rect, sprite.getColor(), &sprite.getTexture(), order, blendMode, shader);
+}
+
+void RenderQueue::submit(const sf::Drawable& drawable, DrawOrder order,
+                         const sf::RenderStates& states) {
+    Command command;
+    command.drawable = &drawable;
+    command.states = states;
+    pushCommand(command, order);
+}
+
+std::size_t RenderQueue::flush(sf::RenderTarget& target, RenderStatsRecorder* stats) {
+    return flushInto(target, stats);
+}
+
+std::size_t RenderQueue::flush(CommandList& list, RenderStatsRecorder* stats) {
+    return flushInto(list, stats);
+}
+
+template <typename Target>
+std::size_t RenderQueue::flushInto(Target& target, RenderStatsRecorder* stats) {
+    if (m_entries.empty()) {
+        return 0;
+    }
+
+    radixSort(m_entries, m_scratch);
+
+    std::size_t drawCalls = 0;
+    std::size_t i = 0;
+    const std::size_t count = m_entries.size();
+
+    while (i < count) {
+        const Command& first = m_commands[m_entries[i].command];
+
+        if (first.drawable) {
+            target.draw(*first.drawable, first.states);
+            if (stats) stats->countDraw(first.states.texture, 0);
+            ++drawCalls;
+            ++i;
+            continue;
+        }
+
+        // Extend the run while the next command is a quad with identical state
+        std::size_t end = i + 1;
+        while (end < count) {
+            const Command& next = m_commands[m_entries[end].command];
+            if (next.drawable
+                || next.states.texture != first.states.texture
+                || next.states.shader != first.states.shader
+                || next.states.blendMode != first.states.blendMode) {
+                break;
+            }
+            ++end;
+        }
+
+        if (end - i == 1) {
+            target.draw(&m_vertices[first.firstVertex], 6,
+                        sf::PrimitiveType::Triangles, first.states);
+        } else {
+            m_merged.clear();
+            for (std::size_t k = i; k < end; ++k) {
+                const std::size_t v = m_commands[m_entries[k].command].firstVertex;
+                m_merged.insert(m_merged.end(), m_vertices.begin() + v, m_vertices.begin() + v + 6);
+            }
+            target.draw(m_merged.data(), m_merged.size(),
+                        sf::PrimitiveType::Triangles, first.states);
+        }
+
+        if (stats) stats->countDraw(first.states.texture, (end - i) * 6);
+        ++drawCalls;
+        i = end;
+    }
+
+    clear();
+    return drawCalls;
+}
+
+void RenderQueue::clear() {
+    m_commands.clear();
+    m_vertices.clear();
+    m_entries.clear();
+    m_textureIds.clear();
+    m_shaderIds.clear();
+    m_blendModes.clear();
+}
+
+bool RenderQueue::empty() const {
+    return m_commands.empty();
+}
+
+std::size_t RenderQueue::size() const {
+    return m_commands.size();
+}
+
+void RenderQueue::pushQuad(const sf::Vector2f (&corners)[4], const sf::IntRect& textureRect,
+                           sf::Color color, const sf::Texture* texture, DrawOrder order,
+                           const sf::BlendMode& blendMode, const sf::Shader* shader) {
+    const float left   = static_cast<float>(textureRect.position.x);
+    const float top    = static_cast<float>(textureRect.position.y);
+    const float right  = left + static_cast<float>(textureRect.size.x);
+    const float bottom = top + static_cast<float>(textureRect.size.y);
+
+    Command command;
+    command.firstVertex = m_vertices.size();
+    command.states.texture = texture;
+    command.states.shader = shader;
+    command.states.blendMode = blendMode;
+
+    const sf::Vertex topLeft     {corners[0], color, {left,  top}};
+    const sf::Vertex topRight    {corners[1], color, {right, top}};
+    const sf::Vertex bottomLeft  {corners[2], color, {left,  bottom}};
+    const sf::Vertex bottomRight {corners[3], color, {right, bottom}};
+
+    m_vertices.push_back(topLeft);
+    m_vertices.push_back(topRight);
+    m_vertices.push_back(bottomLeft);
+    m_vertices.push_back(bottomLeft);
+    m_vertices.push_back(topRight);
+    m_vertices.push_back(bottomRight);
+
+    pushCommand(command, order);
+}
+
+void RenderQueue::pushCommand(Command command, DrawOrder order) {
+    const std::uint64_t key = SortKey::pack(order,
+                                            internShader(command.states.shader),
+                                            internTexture(command.states.texture),
+                                            internBlend(command.states.blendMode));
+
+    m_entries.push_back({key, static_cast<std::uint32_t>(m_commands.size())});
+    m_commands.push_back(command);
+}
+
+std::uint32_t RenderQueue::internTexture(const sf::Texture* texture) {
+    if (!texture) return 0;
+    auto [it, inserted] = m_textureIds.try_emplace(
+        texture, static_cast<std::uint32_t>(m_textureIds.size() + 1));
+    return it->second;
+}
+
+std::uint32_t RenderQueue::internShader(const sf::Shader* shader) {
+    if (!shader) return 0;
+    auto [it, inserted] = m_shaderIds.try_emplace(
+        shader, static_cast<std::uint32_t>(m_shaderIds.size() + 1));
+    return it->second;
+}
+
+std::uint32_t RenderQueue::internBlend(const sf::BlendMode& blendMode) {
+    // Only a handful of blend modes exist in practice; a linear scan is cheapest
+    auto it = std::find(m_blendModes.begin(), m_blendModes.end(), blendMode);
+    if (it != m_blendModes.end()) {
+        return static_cast<std::uint32_t>(it - m_blendModes.begin());
+    }
+    m_blendModes.push_back(blendMode);
+    return static_cast<std::uint32_t>(m_blendModes.size() - 1);
+}
+
+void RenderQueue::radixSort(std::vector<Entry>& entries, std::vector<Entry>& scratch) {
+    const std::size_t count = entries.size();
+    if (count < 2) return;
+
+    scratch.resize(count);
+
+    // Build all eight byte histograms in a single read pass
+    std::array<std::array<std::uint32_t, 256>, 8> histograms{};
+    for (const Entry& entry : entries) {
+        for (unsigned pass = 0; pass < 8; ++pass) {
+            ++histograms[pass][(entry.key >> (pass * 8)) & 0xFF];
+        }
+    }
+
+    Entry* src = entries.data();
+    Entry* dst = scratch.data();
+
+    for (unsigned pass = 0; pass < 8; ++pass) {
+        auto& histogram = histograms[pass];
+        const unsigned shift = pass * 8;
+
+        // Every key has the same byte here: this pass would not move anything
+        if (histogram[(src[0].key >> shift) & 0xFF] == count) {
+            continue;
+        }
+
+        std::uint32_t offset = 0;
+        for (auto& bucket : histogram) {
+            const std::uint32_t n = bucket;
+            bucket = offset;
+            offset += n;
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            dst[histogram[(src[i].key >> shift) & 0xFF]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+
+    if (src != entries.data()) {
+        std::copy(src, src + count, entries.data());
+    }
+}
+
+} // namespace Engine
@@ -0,0 +1,92 @@
+#include "Engine/Graphics/RenderStats.hpp"
+#include <algorithm>
+
+namespace Engine {
+
+void RenderStatsRecorder::countDraw(const sf::Texture* texture, std::size_t vertexCount) {
+    ++m_current.drawCalls;
+    m_current.vertices += vertexCount;
+
+    // An untextured draw unbinds, so drawing the same texture afterwards binds it again
+    if (texture && texture != m_boundTexture) {
+        ++m_current.textureBinds;
+    }
+    m_boundTexture = texture;
+}
+
+void RenderStatsRecorder::countClear() {
+    ++m_current.clears;
+}
+
+void RenderStatsRecorder::countViewChange() {
+    ++m_current.viewChanges;
+}
+
+void RenderStatsRecorder::endFrame(float displayTime) {
+    m_current.displayTime = displayTime;
+
+    m_history[m_historyNext] = m_current;
+    m_historyNext = (m_historyNext + 1) % HistorySize;
+    m_historyCount = std::min(m_historyCount + 1, HistorySize);
+
+    m_current = {};
+    m_boundTexture = nullptr; // Every frame starts from the target's reset state
+}
+
+const RenderStats& RenderStatsRecorder::getCurrent() const {
+    return m_current;
+}
+
+RenderStats RenderStatsRecorder::getLast() const {
+    return m_historyCount > 0 ? getFrame(0) : RenderStats{};
+}
+
+RenderStats RenderStatsRecorder::getFrame(std::size_t framesAgo) const {
+    return m_history[(m_historyNext + HistorySize - 1 - framesAgo) % HistorySize];
+}
+
+std::size_t RenderStatsRecorder::getHistoryCount() const {
+    return m_historyCount;
+}
+
+RenderStats RenderStatsRecorder::getAverage() const {
+    RenderStats average;
+    if (m_historyCount == 0) {
+        return average;
+    }
+
+    double displayTime = 0.0;
+    for (std::size_t i = 0; i < m_historyCount; ++i) {
+        const RenderStats& frame = m_history[i];
+        average.drawCalls += frame.drawCalls;
+        average.vertices += frame.vertices;
+        average.textureBinds += frame.textureBinds;
+        average.viewChanges += frame.viewChanges;
+        average.clears += frame.clears;
+        displayTime += frame.displayTime;
+    }
+
+    average.drawCalls /= m_historyCount;
+    average.vertices /= m_historyCount;
+    average.textureBinds /= m_historyCount;
+    average.viewChanges /= m_historyCount;
+    average.clears /= m_historyCount;
+    average.displayTime = static_cast<float>(displayTime / static_cast<double>(m_historyCount));
+    return average;
+}
+
+RenderStats RenderStatsRecorder::getPeak() const {
+    RenderStats peak;
+    for (std::size_t i = 0; i < m_historyCount; ++i) {
+        const RenderStats& frame = m_history[i];
+        peak.drawCalls = std::max(peak.drawCalls, frame.drawCalls);
+        peak.vertices = std::max(peak.vertices, frame.vertices);
+        peak.textureBinds = std::max(peak.textureBinds, frame.textureBinds);
+        peak.viewChanges = std::max(peak.viewChanges, frame.viewChanges);
+        peak.clears = std::max(peak.clears, frame.clears);
+        peak.displayTime = std::max(peak.displayTime, frame.displayTime);
+    }
+    return peak;
+}
+
+} // namespace Engine
@@ -0,0 +1,102 @@
+#include "Engine/Graphics/RenderThread.hpp"
+#include <stdexcept>
+#include <utility>
+
+namespace Engine {
+
+RenderThread::RenderThread(sf::RenderTarget& target, PresentFunction present)
+    : m_target(target)
+    , m_present(std::move(present))
+    , m_thread(&RenderThread::run, this) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [this] { return m_started; });
+    if (m_failed) {
+        lock.unlock();
+        m_thread.join();
+        throw std::runtime_error("RenderThread: Failed to activate the render context");
+    }
+}
+
+RenderThread::~RenderThread() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_condition.notify_all();
+    m_thread.join();
+}
+
+void RenderThread::submit(const CommandList& list) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [this] { return m_pending == nullptr && !m_busy; });
+    m_pending = &list;
+    lock.unlock();
+    m_condition.notify_all();
+}
+
+void RenderThread::waitIdle() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [this] { return m_pending == nullptr && !m_busy; });
+}
+
+void RenderThread::execute(const std::function<void()>& task) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [this] { return m_pending == nullptr && !m_busy; });
+    m_task = &task;
+    m_condition.notify_all();
+
+    m_condition.wait(lock, [this] { return m_task == nullptr && !m_busy; });
+    if (m_taskError) {
+        std::rethrow_exception(std::exchange(m_taskError, nullptr));
+    }
+}
+
+void RenderThread::run() {
+    const bool active = m_target.setActive(true);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_started = true;
+        m_failed = !active;
+    }
+    m_condition.notify_all();
+    if (!active) return;
+
+    while (true) {
+        const CommandList* list = nullptr;
+        const std::function<void()>* task = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this] { return m_pending || m_task || m_stop; });
+            if (!m_pending && !m_task) break; // Stopping with nothing left to do
+
+            list = std::exchange(m_pending, nullptr);
+            task = std::exchange(m_task, nullptr);
+            m_busy = true;
+        }
+
+        std::exception_ptr error;
+        if (task) {
+            try {
+                (*task)();
+            } catch (...) {
+                error = std::current_exception();
+            }
+        } else {
+            list->replay(m_target);
+            if (m_present) {
+                m_present();
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_busy = false;
+            if (task) m_taskError = error;
+        }
+        m_condition.notify_all();
+    }
+
+    (void)m_target.setActive(false);
+}
+
+} // namespace Engine
@@ -1,61 +1,476 @@
 #include "Engine/Graphics/Renderer.hpp"
+#include <chrono>
+#include <stdexcept>
 
 namespace Engine {
 
-Renderer::Renderer(unsigned int width, unsigned int height, const std::string& title)
-    : m_window(sf::VideoMode({width, height}), title) {
+Renderer::Renderer(unsigned int width, unsigned int height, const std::string& title,
+                   RenderMode mode) {
+    if (mode == RenderMode::Offscreen) {
+        m_offscreen.emplace();
+        if (!m_offscreen->resize({width, height})) {
+            throw std::runtime_error("Renderer: Failed to create offscreen render target");
+        }
+        m_target = &*m_offscreen;
+        m_offscreenOpen = true;
+    } else {
+        m_window.emplace(sf::VideoMode({width, height}), title);
+        m_target = &*m_window;
+    }
+    m_currentView = m_target->getView();
+    updateViewBounds();
+}
+
+Renderer::~Renderer() {
+    // Join the render thread before the window/texture it draws into is destroyed
+    m_renderThread.reset();
+}
+
+template <typename Fn>
+void Renderer::forTarget(Fn&& fn) {
+    if (m_renderThread) {
+        fn(m_lists[m_recordIndex]);
+    } else {
+        fn(*m_target);
+    }
 }
 
 void Renderer::clear(sf::Color color) {
-    m_window.clear(color);
+    flushPending();
+    forTarget([&](auto& target) { target.clear(color); });
+    m_stats.countClear();
 }
 
 void Renderer::draw(const sf::Drawable& drawable) {
-    m_window.draw(drawable);
+    draw(drawable, sf::RenderStates::Default);
 }
 
 void Renderer::draw(const sf::Drawable& drawable, const sf::RenderStates& states) {
-    m_window.draw(drawable, states);
+    flushPending();
+    forTarget([&](auto& target) { target.draw(drawable, states); });
+    m_stats.countDraw(states.texture, 0);
+}
+
+void Renderer::draw(const sf::Vertex* vertices, std::size_t vertexCount,
+                    sf::PrimitiveType type, const sf::RenderStates& states) {
+    flushPending();
+    forTarget([&](auto& target) { target.draw(vertices, vertexCount, type, states); });
+    m_stats.countDraw(states.texture, vertexCount);
+}
+
+void Renderer::draw(const sf::VertexBuffer& buffer, std::size_t firstVertex, std::size_t vertexCount,
+                    const sf::RenderStates& states) {
+    flushPending();
+    forTarget([&](auto& target) { target.draw(buffer, firstVertex, vertexCount, states); });
+    m_stats.countDraw(states.texture, vertexCount);
+}
+
+void Renderer::draw(const sf::Sprite& sprite) {
+    if (cull(sprite.getGlobalBounds())) return;
+    drawCounted(sprite);
+    m_stats.countDraw(&sprite.getTexture(), 4);
+}
+
+void Renderer::draw(const sf::Shape& shape) {
+    if (cull(shape.getGlobalBounds())) return;
+    drawCounted(shape);
+
+    // Fill is a triangle fan (center + closing point); the outline is a second, untextured strip
+    const std::size_t points = shape.getPointCount();
+    m_stats.countDraw(shape.getTexture(), points + 2);
+    if (shape.getOutlineThickness() != 0.f) {
+        m_stats.countDraw(nullptr, (points + 1) * 2);
+    }
+}
+
+void Renderer::draw(const sf::Text& text) {
+    // Estimate: one quad per character
+    const std::size_t vertices = text.getString().getSize() * 6;
+
+    // Measuring a text loads glyphs into its font, whose pages the render
+    // thread may be reading: threaded, texts are recorded unculled and
+    // counted without their texture
+    if (m_renderThread) {
+        drawCounted(text);
+        m_stats.countDraw(nullptr, vertices);
+        return;
+    }
+
+    if (cull(text.getGlobalBounds())) return;
+    drawCounted(text);
+    m_stats.countDraw(&text.getFont().getTexture(text.getCharacterSize()), vertices);
+}
+
+void Renderer::draw(const sf::VertexArray& vertices) {
+    if (cull(vertices.getBounds())) return;
+    drawCounted(vertices);
+    m_stats.countDraw(nullptr, vertices.getVertexCount());
+}
+
+void Renderer::setCullingEnabled(bool enabled) {
+    m_cullingEnabled = enabled;
+}
+
+bool Renderer::isCullingEnabled() const {
+    return m_cullingEnabled;
+}
+
+const sf::FloatRect& Renderer::getViewBounds() const {
+    return m_viewBounds;
+}
+
+bool Renderer::isVisible(const sf::FloatRect& worldBounds) const {
+    // Inlined overlap test: this runs for every submission, so avoid
+    // findIntersection() building an optional rectangle
+    return worldBounds.position.x <= m_viewBounds.position.x + m_viewBounds.size.x
+        && worldBounds.position.x + worldBounds.size.x >= m_viewBounds.position.x
+        && worldBounds.position.y <= m_viewBounds.position.y + m_viewBounds.size.y
+        && worldBounds.position.y + worldBounds.size.y >= m_viewBounds.position.y;
+}
+
+const Renderer::CullStats& Renderer::getCullStats() const {
+    return m_lastCullStats;
+}
+
+void Renderer::beginBatch() {
+    m_batch.begin();
+}
+
+void Renderer::submit(const sf::Texture& texture,
+                      const sf::FloatRect& destination,
+                      const sf::IntRect& textureRect,
+                      sf::Color color,
+                      const sf::BlendMode& blendMode) {
+    // Outside beginBatch()/endBatch() the quad would be discarded by the next begin
+    if (!m_batch.isActive() || cull(destination)) return;
+    m_batch.submit(texture, destination, textureRect, color, blendMode);
+}
+
+void Renderer::submit(const sf::Sprite& sprite, const sf::BlendMode& blendMode) {
+    if (!m_batch.isActive() || cull(sprite.getGlobalBounds())) return;
+    m_batch.submit(sprite, blendMode);
+}
+
+void Renderer::endBatch() {
+    flushQueue();
+    forTarget([&](auto& target) { m_batch.end(target, &m_stats); });
+}
+
+void Renderer::enqueue(const sf::Texture& texture,
+                       const sf::FloatRect& destination,
+                       const sf::IntRect& textureRect,
+                       DrawOrder order,
+                       sf::Color color,
+                       const sf::BlendMode& blendMode,
+                       const sf::Shader* shader) {
+    if (cull(destination)) return;
+    m_queue.submit(texture, destination, textureRect, order, color, blendMode, shader);
+}
+
+void Renderer::enqueue(const sf::Sprite& sprite,
+                       DrawOrder order,
+                       const sf::BlendMode& blendMode,
+                       const sf::Shader* shader) {
+    if (cull(sprite.getGlobalBounds())) return;
+    m_queue.submit(sprite, order, blendMode, shader);
+}
+
+void Renderer::enqueue(const sf::Drawable& drawable, DrawOrder order,
+                       const sf::RenderStates& states) {
+    m_queue.submit(drawable, order, states);
+}
+
+StaticLayer& Renderer::createStaticLayer(const std::string& id, const sf::FloatRect& area) {
+    auto it = m_staticLayers.find(id);
+    if (it == m_staticLayers.end()) {
+        it = m_staticLayers.emplace(id, std::make_unique<StaticLayer>(area)).first;
+    }
+    return *it->second;
+}
+
+StaticLayer& Renderer::getStaticLayer(const std::string& id) {
+    auto it = m_staticLayers.find(id);
+    if (it == m_staticLayers.end()) {
+        throw std::runtime_error(
+            "Renderer: Static layer not found -> " + id);
+    }
+    return *it->second;
+}
+
+bool Renderer::hasStaticLayer(const std::string& id) const {
+    return m_staticLayers.find(id) != m_staticLayers.end();
+}
+
+void Renderer::invalidateStaticLayer(const std::string& id) {
+    getStaticLayer(id).invalidate();
+}
+
+void Renderer::removeStaticLayer(const std::string& id) {
+    const auto it = m_staticLayers.find(id);
+    if (it == m_staticLayers.end()) return;
+
+    // The frame in flight and the one being recorded may both composite
+    // the layer: keep it alive until the frame recorded now has been drawn
+    if (m_renderThread) {
+        m_retiredLayers[m_recordIndex].push_back(std::move(it->second));
+    }
+    m_staticLayers.erase(it);
+}
+
+void Renderer::drawStaticLayer(const std::string& id, const StaticLayer::RedrawFunction& redraw) {
+    StaticLayer& layer = getStaticLayer(id);
+
+    // An off-screen layer stays dirty; it is re-rendered once it becomes visible
+    if (cull(layer.getArea())) return;
+
+    // The in-flight frame may still sample the layer: re-render it on the
+    // render thread once that frame is done
+    if (layer.isDirty()) {
+        onRenderThread([&] { layer.refresh(redraw); });
+    }
+
+    flushPending();
+    forTarget([&](auto& target) { layer.composite(target); });
+    m_stats.countDraw(&layer.getTexture(), 6);
+}
+
+std::size_t Renderer::getDrawCallCount() const {
+    return m_stats.getLast().drawCalls;
+}
+
+const RenderStatsRecorder& Renderer::getRenderStats() const {
+    return m_stats;
 }
 
 void Renderer::display() {
-    m_window.display();
+    const auto start = std::chrono::steady_clock::now();
+
+    // A batch left open at the end of the frame would silently drop its quads
+    if (m_batch.isActive()) {
+        endBatch();
+    }
+    flushQueue();
+
+    if (m_renderThread) {
+        // Sync point: waits for the previous frame, then hands this one over
+        // and starts recording the next frame into the other list
+        m_renderThread->submit(m_lists[m_recordIndex]);
+        m_recordIndex ^= 1;
+        m_lists[m_recordIndex].reset();
+        m_retiredLayers[m_recordIndex].clear(); // Only that finished frame could still use them
+    } else {
+        present();
+    }
+
+    m_stats.endFrame(std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count());
+    m_lastCullStats = m_cullStats;
+    m_cullStats = {};
 }
 
 bool Renderer::isOpen() const {
-    return m_window.isOpen();
+    return m_window ? m_window->isOpen() : m_offscreenOpen;
 }
 
 void Renderer::close() {
-    m_window.close();
+    setThreadedRendering(false);
+
+    if (m_window) {
+        m_window->close();
+    } else {
+        m_offscreenOpen = false;
+    }
 }
 
 void Renderer::setFramerateLimit(unsigned int limit) {
-    m_window.setFramerateLimit(limit);
+    if (m_window) {
+        // The limit is read by display(), which runs on the render thread
+        onRenderThread([&] { m_window->setFramerateLimit(limit); });
+    }
+}
+
+void Renderer::setVerticalSyncEnabled(bool enabled) {
+    if (m_window) {
+        // Activates the window's context, which the render thread owns
+        onRenderThread([&] { m_window->setVerticalSyncEnabled(enabled); });
+    }
 }
 
 sf::Vector2u Renderer::getSize() const {
-    return m_window.getSize();
+    return m_target->getSize();
 }
 
 void Renderer::setView(const sf::View& view) {
-    m_window.setView(view);
+    // Queued commands and batched quads were recorded against the previous view
+    flushPending();
+    forTarget([&](auto& target) { target.setView(view); });
+    m_stats.countViewChange();
+    m_currentView = view;
+    updateViewBounds();
 }
 
 const sf::View& Renderer::getView() const {
-    return m_window.getView();
+    // Mirrored: with a render thread the target's own view lags behind recording
+    return m_currentView;
 }
 
 const sf::View& Renderer::getDefaultView() const {
-    return m_window.getDefaultView();
+    return m_target->getDefaultView();
 }
 
 sf::RenderWindow& Renderer::getWindow() {
-    return m_window;
+    if (!m_window) {
+        throw std::runtime_error("Renderer: No window in offscreen mode");
+    }
+    return *m_window;
 }
 
 const sf::RenderWindow& Renderer::getWindow() const {
-    return m_window;
+    if (!m_window) {
+        throw std::runtime_error("Renderer: No window in offscreen mode");
+    }
+    return *m_window;
+}
+
+sf::RenderTarget& Renderer::getTarget() {
+    return *m_target;
+}
+
+bool Renderer::isOffscreen() const {
+    return !m_window.has_value();
+}
+
+sf::Image Renderer::captureFrame() const {
+    if (!m_offscreen) {
+        throw std::runtime_error("Renderer: Frame capture requires offscreen mode");
+    }
+    if (m_renderThread) {
+        m_renderThread->waitIdle(); // The last submitted frame must be finished
+    }
+    return m_offscreen->getTexture().copyToImage();
+}
+
+std::uint64_t Renderer::hashFrame() const {
+    const sf::Image frame = captureFrame();
+    const std::uint8_t* pixels = frame.getPixelsPtr();
+    const std::size_t byteCount = static_cast<std::size_t>(frame.getSize().x) * frame.getSize().y * 4;
+
+    // 64-bit FNV-1a: stable across platforms and runs, good enough to detect any change
+    std::uint64_t hash = 14695981039346656037ull;
+    for (std::size_t i = 0; i < byteCount; ++i) {
+        hash ^= pixels[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+void Renderer::saveFrame(const std::filesystem::path& filename) const {
+    if (!captureFrame().saveToFile(filename)) {
+        throw std::runtime_error(
+            "Renderer: Failed to save frame '" + filename.string() + "'");
+    }
+}
+
+void Renderer::setThreadedRendering(bool enabled) {
+    if (enabled == static_cast<bool>(m_renderThread)) {
+        return;
+    }
+
+    if (enabled) {
+        if (!isOpen()) return;
+
+        // Hand the OpenGL context over to the render thread
+        if (!m_target->setActive(false)) {
+            throw std::runtime_error("Renderer: Failed to release the render context");
+        }
+        m_recordIndex = 0;
+        m_lists[0].reset();
+        m_lists[1].reset();
+        try {
+            m_renderThread = std::make_unique<RenderThread>(*m_target, [this] { present(); });
+        } catch (...) {
+            // Stay single-threaded with the context back on this thread
+            (void)m_target->setActive(true);
+            throw;
+        }
+    } else {
+        // Anything recorded since the last display() is dropped, like an unpresented frame
+        m_renderThread.reset();
+        m_retiredLayers[0].clear();
+        m_retiredLayers[1].clear();
+        if (!m_target->setActive(true)) {
+            throw std::runtime_error("Renderer: Failed to reacquire the render context");
+        }
+        m_target->setView(m_currentView);
+    }
+}
+
+bool Renderer::isThreadedRendering() const {
+    return static_cast<bool>(m_renderThread);
+}
+
+void Renderer::runOnRenderThread(const std::function<void()>& task) {
+    onRenderThread(task);
+}
+
+template <typename Fn>
+void Renderer::onRenderThread(Fn&& fn) {
+    if (m_renderThread) {
+        m_renderThread->execute(fn);
+    } else {
+        fn();
+    }
+}
+
+void Renderer::drawCounted(const sf::Drawable& drawable) {
+    flushPending();
+    forTarget([&](auto& target) { target.draw(drawable); });
+}
+
+void Renderer::present() {
+    if (m_window) {
+        m_window->display();
+    } else {
+        m_offscreen->display();
+    }
+}
+
+bool Renderer::cull(const sf::FloatRect& worldBounds) {
+    if (!m_cullingEnabled) {
+        return false;
+    }
+
+    if (isVisible(worldBounds)) {
+        ++m_cullStats.drawn;
+        return false;
+    }
+
+    ++m_cullStats.culled;
+    return true;
+}
+
+void Renderer::updateViewBounds() {
+    // The inverse view transform maps normalized device coordinates back to
+    // world space; transforming the NDC square gives the view's AABB even
+    // when the view is rotated.
+    m_viewBounds = m_currentView.getInverseTransform().transformRect(
+        sf::FloatRect({-1.f, -1.f}, {2.f, 2.f}));
+}
+
+void Renderer::flushPending() {
+    flushQueue();
+
+    // Draw the quads collected so far under the view they were culled
+    // against, and keep the batch open for the submissions that follow
+    if (m_batch.isActive() && m_batch.getQuadCount() > 0) {
+        forTarget([&](auto& target) { m_batch.end(target, &m_stats); });
+        m_batch.begin();
+    }
+}
+
+void Renderer::flushQueue() {
+    if (!m_queue.empty()) {
+        forTarget([&](auto& target) { m_queue.flush(target, &m_stats); });
+    }
 }
 
 } // namespace Engine
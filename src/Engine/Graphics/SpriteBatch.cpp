@@ -0,0 +1,135 @@
+#include "Engine/Graphics/SpriteBatch.hpp"
+#include <cmath>
+
+namespace Engine {
+
+void SpriteBatch::begin() {
+    for (std::size_t i = 0; i < m_batchCount; ++i) {
+        m_batches[i].vertices.clear(); // Keeps capacity for the next frame
+    }
+    m_batchCount = 0;
+    m_lastBatch = 0;
+    m_quadCount = 0;
+    m_active = true;
+}
+
+void SpriteBatch::submit(const sf::Texture& texture,
+                         const sf::FloatRect& destination,
+                         const sf::IntRect& textureRect,
+                         sf::Color color,
+                         const sf::BlendMode& blendMode) {
+    const sf::Vector2f min = destination.position;
+    const sf::Vector2f max = destination.position + destination.size;
+    const sf::Vector2f corners[4] = {
+        min, {max.x, min.y}, {min.x, max.y}, max
+    };
+
+    appendQuad(batchFor(texture, blendMode), corners, textureRect, color);
+    ++m_quadCount;
+}
+
+void SpriteBatch::submit(const sf::Sprite& sprite, const sf::BlendMode& blendMode) {
+    const sf::IntRect& rect = sprite.getTextureRect();
+    const float width  = static_cast<float>(std::abs(rect.size.x));
+    const float height = static_cast<float>(std::abs(rect.size.y));
+
+    const sf::Transform& transform = sprite.getTransform();
+    const sf::Vector2f corners[4] = {
+        transform.transformPoint({0.f, 0.f}),
+        transform.transformPoint({width, 0.f}),
+        transform.transformPoint({0.f, height}),
+        transform.transformPoint({width, height})
+    };
+
+    appendQuad(batchFor(sprite.getTexture(), blendMode), corners, rect, sprite.getColor());
+    ++m_quadCount;
+}
+
+std::size_t SpriteBatch::end(sf::RenderTarget& target, RenderStatsRecorder* stats) {
+    return endInto(target, stats);
+}
+
+std::size_t SpriteBatch::end(CommandList& list, RenderStatsRecorder* stats) {
+    return endInto(list, stats);
+}
+
+template <typename Target>
+std::size_t SpriteBatch::endInto(Target& target, RenderStatsRecorder* stats) {
+    std::size_t drawCalls = 0;
+
+    for (std::size_t i = 0; i < m_batchCount; ++i) {
+        const Batch& batch = m_batches[i];
+        if (batch.vertices.empty()) continue;
+
+        sf::RenderStates states(batch.texture);
+        states.blendMode = batch.blendMode;
+        target.draw(batch.vertices.data(), batch.vertices.size(),
+                    sf::PrimitiveType::Triangles, states);
+        if (stats) stats->countDraw(batch.texture, batch.vertices.size());
+        ++drawCalls;
+    }
+
+    m_active = false;
+    return drawCalls;
+}
+
+bool SpriteBatch::isActive() const {
+    return m_active;
+}
+
+std::size_t SpriteBatch::getQuadCount() const {
+    return m_quadCount;
+}
+
+SpriteBatch::Batch& SpriteBatch::batchFor(const sf::Texture& texture,
+                                          const sf::BlendMode& blendMode) {
+    // Sprites usually arrive in runs of the same texture; check the last group first
+    if (m_lastBatch < m_batchCount) {
+        Batch& last = m_batches[m_lastBatch];
+        if (last.texture == &texture && last.blendMode == blendMode) {
+            return last;
+        }
+    }
+
+    for (std::size_t i = 0; i < m_batchCount; ++i) {
+        if (m_batches[i].texture == &texture && m_batches[i].blendMode == blendMode) {
+            m_lastBatch = i;
+            return m_batches[i];
+        }
+    }
+
+    if (m_batchCount == m_batches.size()) {
+        m_batches.emplace_back();
+    }
+
+    Batch& batch = m_batches[m_batchCount];
+    batch.texture = &texture;
+    batch.blendMode = blendMode;
+    batch.vertices.clear();
+
+    m_lastBatch = m_batchCount++;
+    return batch;
+}
+
+void SpriteBatch::appendQuad(Batch& batch, const sf::Vector2f (&corners)[4],
+                             const sf::IntRect& textureRect, sf::Color color) {
+    const float left   = static_cast<float>(textureRect.position.x);
+    const float top    = static_cast<float>(textureRect.position.y);
+    const float right  = left + static_cast<float>(textureRect.size.x);
+    const float bottom = top + static_cast<float>(textureRect.size.y);
+
+    const sf::Vertex topLeft     {corners[0], color, {left,  top}};
+    const sf::Vertex topRight    {corners[1], color, {right, top}};
+    const sf::Vertex bottomLeft  {corners[2], color, {left,  bottom}};
+    const sf::Vertex bottomRight {corners[3], color, {right, bottom}};
+
+    // Two triangles per quad (SFML 3 has no quad primitive)
+    batch.vertices.push_back(topLeft);
+    batch.vertices.push_back(topRight);
+    batch.vertices.push_back(bottomLeft);
+    batch.vertices.push_back(bottomLeft);
+    batch.vertices.push_back(topRight);
+    batch.vertices.push_back(bottomRight);
+}
+
+} // namespace Engine
@@ -0,0 +1,79 @@
+#include "Engine/Graphics/StaticLayer.hpp"
+#include <cmath>
+#include <stdexcept>
+
+namespace Engine {
+
+StaticLayer::StaticLayer(const sf::FloatRect& area)
+    : m_area(area) {
+    const sf::Vector2u size{static_cast<unsigned int>(std::ceil(area.size.x)),
+                            static_cast<unsigned int>(std::ceil(area.size.y))};
+
+    if (size.x == 0 || size.y == 0 || !m_texture.resize(size)) {
+        throw std::runtime_error("StaticLayer: Failed to create render texture");
+    }
+    m_texture.setView(sf::View(area));
+
+    const sf::Vector2f min = area.position;
+    const sf::Vector2f max = area.position + area.size;
+    const sf::Vector2f texSize = area.size;
+
+    const sf::Vertex topLeft     {min,            sf::Color::White, {0.f,       0.f}};
+    const sf::Vertex topRight    {{max.x, min.y}, sf::Color::White, {texSize.x, 0.f}};
+    const sf::Vertex bottomLeft  {{min.x, max.y}, sf::Color::White, {0.f,       texSize.y}};
+    const sf::Vertex bottomRight {max,            sf::Color::White, texSize};
+
+    m_quad = {topLeft, topRight, bottomLeft, bottomLeft, topRight, bottomRight};
+}
+
+void StaticLayer::invalidate() {
+    m_dirty = true;
+}
+
+bool StaticLayer::isDirty() const {
+    return m_dirty;
+}
+
+bool StaticLayer::refresh(const RedrawFunction& redraw) {
+    if (!m_dirty) {
+        return false;
+    }
+
+    m_texture.clear(m_clearColor);
+    if (redraw) {
+        redraw(m_texture);
+    }
+    m_texture.display();
+
+    m_dirty = false;
+    return true;
+}
+
+void StaticLayer::composite(sf::RenderTarget& target, const sf::RenderStates& states) const {
+    sf::RenderStates layerStates = states;
+    layerStates.texture = &m_texture.getTexture();
+    target.draw(m_quad.data(), m_quad.size(), sf::PrimitiveType::Triangles, layerStates);
+}
+
+void StaticLayer::composite(CommandList& list, const sf::RenderStates& states) const {
+    sf::RenderStates layerStates = states;
+    layerStates.texture = &m_texture.getTexture();
+    list.draw(m_quad.data(), m_quad.size(), sf::PrimitiveType::Triangles, layerStates);
+}
+
+const sf::Texture& StaticLayer::getTexture() const {
+    return m_texture.getTexture();
+}
+
+const sf::FloatRect& StaticLayer::getArea() const {
+    return m_area;
+}
+
+void StaticLayer::setClearColor(sf::Color color) {
+    if (color != m_clearColor) {
+        m_clearColor = color;
+        m_dirty = true;
+    }
+}
+
+} // namespace Engine
@@ -0,0 +1,201 @@
+#include "Engine/Graphics/TileMap.hpp"
+#include "Engine/Graphics/Renderer.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Engine {
+
+TileMap::TileMap(sf::Vector2u mapSize, sf::Vector2u tileSize,
+                 const sf::Texture& tileset, unsigned int chunkSize)
+    : m_mapSize(mapSize)
+    , m_tileSize(tileSize)
+    , m_tileset(&tileset)
+    , m_chunkSize(std::max(chunkSize, 1u))
+    , m_chunkCount((mapSize.x + m_chunkSize - 1) / m_chunkSize,
+                   (mapSize.y + m_chunkSize - 1) / m_chunkSize)
+    , m_tiles(static_cast<std::size_t>(mapSize.x) * mapSize.y, Empty)
+    , m_chunks(static_cast<std::size_t>(m_chunkCount.x) * m_chunkCount.y)
+    , m_useBuffers(sf::VertexBuffer::isAvailable()) {
+}
+
+void TileMap::setTile(sf::Vector2u cell, TileId tile) {
+    if (cell.x >= m_mapSize.x || cell.y >= m_mapSize.y) {
+        return;
+    }
+
+    TileId& current = m_tiles[static_cast<std::size_t>(cell.y) * m_mapSize.x + cell.x];
+    if (current != tile) {
+        current = tile;
+        chunkAt(cell).dirty = true;
+    }
+}
+
+TileMap::TileId TileMap::getTile(sf::Vector2u cell) const {
+    if (cell.x >= m_mapSize.x || cell.y >= m_mapSize.y) {
+        return Empty;
+    }
+    return m_tiles[static_cast<std::size_t>(cell.y) * m_mapSize.x + cell.x];
+}
+
+void TileMap::fill(TileId tile) {
+    std::fill(m_tiles.begin(), m_tiles.end(), tile);
+    for (Chunk& chunk : m_chunks) {
+        chunk.dirty = true;
+    }
+}
+
+void TileMap::draw(Renderer& renderer) {
+    m_drawnChunks = 0;
+    if (m_chunks.empty() || m_tileSize.x == 0 || m_tileSize.y == 0) {
+        return;
+    }
+
+    // Chunk range overlapping the view (map-local coordinates)
+    const sf::FloatRect& view = renderer.getViewBounds();
+    const sf::Vector2f chunkPixels{static_cast<float>(m_chunkSize * m_tileSize.x),
+                                   static_cast<float>(m_chunkSize * m_tileSize.y)};
+    const sf::Vector2f local = view.position - m_position;
+
+    const auto firstChunk = [](float coord, float extent) {
+        return static_cast<long long>(std::floor(coord / extent));
+    };
+    const long long minX = std::max(0LL, firstChunk(local.x, chunkPixels.x));
+    const long long minY = std::max(0LL, firstChunk(local.y, chunkPixels.y));
+    const long long maxX = std::min<long long>(m_chunkCount.x - 1,
+                                               firstChunk(local.x + view.size.x, chunkPixels.x));
+    const long long maxY = std::min<long long>(m_chunkCount.y - 1,
+                                               firstChunk(local.y + view.size.y, chunkPixels.y));
+
+    // Pick the dirty chunks to rebuild first: their vertex buffers may be
+    // drawn by the frame in flight, so the rebuilds run together on the
+    // render thread once that frame is done
+    std::size_t rebuilt = 0;
+    m_rebuildQueue.clear();
+    for (long long cy = minY; cy <= maxY; ++cy) {
+        for (long long cx = minX; cx <= maxX; ++cx) {
+            const std::size_t index = static_cast<std::size_t>(cy) * m_chunkCount.x + static_cast<std::size_t>(cx);
+            const Chunk& chunk = m_chunks[index];
+            if (!chunk.dirty) continue;
+
+            const bool withinBudget = m_rebuildBudget == 0 || rebuilt < m_rebuildBudget;
+            if (!chunk.built || withinBudget) {
+                if (chunk.built) ++rebuilt;
+                m_rebuildQueue.push_back(index);
+            }
+        }
+    }
+    if (!m_rebuildQueue.empty()) {
+        renderer.runOnRenderThread([this] {
+            for (const std::size_t index : m_rebuildQueue) {
+                rebuild(m_chunks[index], {static_cast<unsigned int>(index % m_chunkCount.x),
+                                          static_cast<unsigned int>(index / m_chunkCount.x)});
+            }
+        });
+    }
+
+    sf::RenderStates states(m_tileset);
+    states.transform.translate(m_position);
+
+    for (long long cy = minY; cy <= maxY; ++cy) {
+        for (long long cx = minX; cx <= maxX; ++cx) {
+            const Chunk& chunk = m_chunks[static_cast<std::size_t>(cy) * m_chunkCount.x
+                                          + static_cast<std::size_t>(cx)];
+            if (chunk.vertexCount == 0) continue;
+
+            if (m_useBuffers) {
+                renderer.draw(chunk.buffer, 0, chunk.vertexCount, states);
+            } else {
+                renderer.draw(chunk.fallback.data(), chunk.vertexCount,
+                              sf::PrimitiveType::Triangles, states);
+            }
+            ++m_drawnChunks;
+        }
+    }
+}
+
+void TileMap::setRebuildBudget(std::size_t chunksPerFrame) {
+    m_rebuildBudget = chunksPerFrame;
+}
+
+void TileMap::setPosition(sf::Vector2f position) {
+    m_position = position;
+}
+
+sf::Vector2f TileMap::getPosition() const {
+    return m_position;
+}
+
+sf::Vector2u TileMap::getMapSize() const {
+    return m_mapSize;
+}
+
+sf::Vector2u TileMap::getTileSize() const {
+    return m_tileSize;
+}
+
+std::size_t TileMap::getDrawnChunkCount() const {
+    return m_drawnChunks;
+}
+
+void TileMap::rebuild(Chunk& chunk, sf::Vector2u chunkCoords) {
+    const unsigned int columns = std::max(1u, m_tileset->getSize().x / m_tileSize.x);
+    const sf::Vector2f tileSize{static_cast<float>(m_tileSize.x), static_cast<float>(m_tileSize.y)};
+
+    const unsigned int beginX = chunkCoords.x * m_chunkSize;
+    const unsigned int beginY = chunkCoords.y * m_chunkSize;
+    const unsigned int endX = std::min(beginX + m_chunkSize, m_mapSize.x);
+    const unsigned int endY = std::min(beginY + m_chunkSize, m_mapSize.y);
+
+    m_scratch.clear();
+    for (unsigned int y = beginY; y < endY; ++y) {
+        for (unsigned int x = beginX; x < endX; ++x) {
+            const TileId tile = m_tiles[static_cast<std::size_t>(y) * m_mapSize.x + x];
+            if (tile == Empty) continue;
+
+            const sf::Vector2f min{static_cast<float>(x) * tileSize.x, static_cast<float>(y) * tileSize.y};
+            const sf::Vector2f max = min + tileSize;
+            const sf::Vector2f uvMin{static_cast<float>(tile % columns) * tileSize.x,
+                                     static_cast<float>(tile / columns) * tileSize.y};
+            const sf::Vector2f uvMax = uvMin + tileSize;
+
+            const sf::Vertex topLeft     {min,            sf::Color::White, uvMin};
+            const sf::Vertex topRight    {{max.x, min.y}, sf::Color::White, {uvMax.x, uvMin.y}};
+            const sf::Vertex bottomLeft  {{min.x, max.y}, sf::Color::White, {uvMin.x, uvMax.y}};
+            const sf::Vertex bottomRight {max,            sf::Color::White, uvMax};
+
+            m_scratch.push_back(topLeft);
+            m_scratch.push_back(topRight);
+            m_scratch.push_back(bottomLeft);
+            m_scratch.push_back(bottomLeft);
+            m_scratch.push_back(topRight);
+            m_scratch.push_back(bottomRight);
+        }
+    }
+
+    chunk.vertexCount = m_scratch.size();
+    chunk.dirty = false;
+    chunk.built = true;
+
+    if (!m_useBuffers) {
+        chunk.fallback = m_scratch;
+        return;
+    }
+
+    if (m_scratch.empty()) return;
+
+    // Grow the GPU buffer only when needed; shrinking just draws fewer vertices
+    if (chunk.buffer.getVertexCount() < m_scratch.size() && !chunk.buffer.create(m_scratch.size())) {
+        chunk.vertexCount = 0;
+        return;
+    }
+    if (!chunk.buffer.update(m_scratch.data(), m_scratch.size(), 0)) {
+        chunk.vertexCount = 0;
+    }
+}
+
+TileMap::Chunk& TileMap::chunkAt(sf::Vector2u cell) {
+    return m_chunks[static_cast<std::size_t>(cell.y / m_chunkSize) * m_chunkCount.x
+                    + cell.x / m_chunkSize];
+}
+
+} // namespace Engine
@@ -10,6 +10,11 @@ void InputManager::pollEvents(Renderer& renderer) {
     m_releasedThisFrame.clear();
     m_closeRequested = false;
 
+    // Offscreen rendering has no window and therefore no events, and must
+    // not see keys held on the host either
+    m_deviceInput = !renderer.isOffscreen();
+    if (!m_deviceInput) return;
+
     auto& window = renderer.getWindow();
 
     while (const auto event = window.pollEvent()) {
@@ -44,6 +49,8 @@ void InputManager::clearBindings() {
 }
 
 bool InputManager::isActionHeld(const Action& action) const {
+    if (!m_deviceInput) return false;
+
     auto it = m_bindings.find(action);
     if (it == m_bindings.end()) return false;
 
@@ -55,15 +62,16 @@ bool InputManager::isActionHeld(const Action& action) const {
     return false;
 }
 
-bool InputManager::isKeyHeld(sf::Keyboard::Key key) {
-    return sf::Keyboard::isKeyPressed(key);
+bool InputManager::isKeyHeld(sf::Keyboard::Key key) const {
+    return m_deviceInput && sf::Keyboard::isKeyPressed(key);
 }
 
-bool InputManager::isMouseButtonHeld(sf::Mouse::Button button) {
-    return sf::Mouse::isButtonPressed(button);
+bool InputManager::isMouseButtonHeld(sf::Mouse::Button button) const {
+    return m_deviceInput && sf::Mouse::isButtonPressed(button);
 }
 
 sf::Vector2i InputManager::getMousePosition(const Renderer& renderer) const {
+    if (renderer.isOffscreen()) return {0, 0};
     return sf::Mouse::getPosition(renderer.getWindow());
 }
 
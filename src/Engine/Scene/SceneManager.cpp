@@ -2,6 +2,15 @@
 
 namespace Engine {
 
+SceneManager::~SceneManager() {
+    if (m_newScene) {
+        m_newScene->scheduler().clear();
+    }
+    while (!m_scenes.empty()) {
+        destroyTop();
+    }
+}
+
 void SceneManager::pushScene(SceneRef newScene, bool isReplacing) {
     m_isAdding = true;
     m_isReplacing = isReplacing;
@@ -15,7 +24,7 @@ void SceneManager::popScene() {
 void SceneManager::processSceneChanges() {
     // Handle removal request
     if (m_isRemoving && !m_scenes.empty()) {
-        m_scenes.pop();
+        destroyTop();
         if (!m_scenes.empty()) {
             m_scenes.top()->resume();
         }
@@ -26,7 +35,7 @@ void SceneManager::processSceneChanges() {
     if (m_isAdding) {
         if (!m_scenes.empty()) {
             if (m_isReplacing) {
-                m_scenes.pop();
+                destroyTop();
             } else {
                 m_scenes.top()->pause();
             }
@@ -38,6 +47,14 @@ void SceneManager::processSceneChanges() {
     }
 }
 
+void SceneManager::destroyTop() {
+    // The scheduler is a base-class member, destroyed after the derived
+    // scene's members: suspended behaviours capturing the scene must be
+    // destroyed while those members still exist
+    m_scenes.top()->scheduler().clear();
+    m_scenes.pop();
+}
+
 SceneRef& SceneManager::getActiveScene() {
     return m_scenes.top();
 }
@@ -0,0 +1,60 @@
+#include "Engine/Script/FrameAllocator.hpp"
+#include <new>
+
+namespace Engine {
+
+FrameAllocator& FrameAllocator::instance() {
+    static FrameAllocator allocator;
+    return allocator;
+}
+
+void* FrameAllocator::allocate(std::size_t size) {
+    ++m_liveCount;
+
+    if (size > MaxPooledSize) {
+        return ::operator new(size);
+    }
+
+    const std::size_t cls = (size + Granularity - 1) / Granularity - 1;
+    if (FreeBlock* block = m_freeLists[cls]) {
+        m_freeLists[cls] = block->next;
+        return block;
+    }
+
+    const std::size_t blockSize = (cls + 1) * Granularity;
+    if (m_remaining < blockSize) {
+        // The tail of the previous chunk (< MaxPooledSize) is abandoned
+        m_chunks.push_back(std::make_unique<std::byte[]>(ChunkSize));
+        m_cursor = m_chunks.back().get();
+        m_remaining = ChunkSize;
+    }
+
+    void* block = m_cursor;
+    m_cursor += blockSize;
+    m_remaining -= blockSize;
+    return block;
+}
+
+void FrameAllocator::deallocate(void* block, std::size_t size) noexcept {
+    --m_liveCount;
+
+    if (size > MaxPooledSize) {
+        ::operator delete(block);
+        return;
+    }
+
+    const std::size_t cls = (size + Granularity - 1) / Granularity - 1;
+    auto* freeBlock = static_cast<FreeBlock*>(block);
+    freeBlock->next = m_freeLists[cls];
+    m_freeLists[cls] = freeBlock;
+}
+
+std::size_t FrameAllocator::getLiveCount() const {
+    return m_liveCount;
+}
+
+std::size_t FrameAllocator::getReservedBytes() const {
+    return m_chunks.size() * ChunkSize;
+}
+
+} // namespace Engine
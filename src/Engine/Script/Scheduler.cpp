@@ -0,0 +1,106 @@
+#include "Engine/Script/Scheduler.hpp"
+#include <algorithm>
+
+namespace Engine {
+
+namespace {
+
+/// Slack for comparing accumulated time, so waitSeconds(1) at 60 Hz wakes
+/// on tick 60 even if 60 additions of 1/60 land just below 1.0.
+constexpr double TimeEpsilon = 1e-6;
+
+} // namespace
+
+Scheduler::~Scheduler() {
+    clear();
+}
+
+void Scheduler::start(Task task) {
+    Task::Handle handle = task.release();
+    if (!handle) return;
+
+    Task::promise_type& promise = handle.promise();
+    promise.scheduler = this;
+    promise.prev = nullptr;
+    promise.next = m_head;
+    if (m_head) m_head->prev = &promise;
+    m_head = &promise;
+    ++m_count;
+
+    resume(handle);
+}
+
+void Scheduler::tick(float dt) {
+    m_time += dt;
+
+    // Collect the batch first: behaviours resumed below that wait again
+    // (even for 0 seconds) are picked up by the next tick, not this one
+    m_resuming.clear();
+    while (!m_timers.empty() && m_timers.front().wakeTime <= m_time + TimeEpsilon) {
+        std::pop_heap(m_timers.begin(), m_timers.end(), Later{});
+        m_resuming.push_back(m_timers.back().handle);
+        m_timers.pop_back();
+    }
+    m_resuming.insert(m_resuming.end(), m_pending.begin(), m_pending.end());
+    m_pending.clear();
+
+    for (std::size_t i = 0; i < m_resuming.size(); ++i) {
+        try {
+            resume(m_resuming[i]);
+        } catch (...) {
+            // Keep the rest of the batch for the next tick instead of losing it
+            m_pending.insert(m_pending.begin(), m_resuming.begin() + i + 1, m_resuming.end());
+            throw;
+        }
+    }
+}
+
+void Scheduler::clear() {
+    while (m_head) {
+        Task::promise_type& promise = *m_head;
+        unlink(promise);
+        Task::Handle::from_promise(promise).destroy();
+    }
+    m_timers.clear();
+    m_pending.clear();
+}
+
+std::size_t Scheduler::size() const {
+    return m_count;
+}
+
+double Scheduler::getTime() const {
+    return m_time;
+}
+
+void Scheduler::resumeAfter(Task::Handle handle, float seconds) {
+    m_timers.push_back({m_time + std::max(seconds, 0.f), m_sequence++, handle});
+    std::push_heap(m_timers.begin(), m_timers.end(), Later{});
+}
+
+void Scheduler::resumeNextTick(Task::Handle handle) {
+    m_pending.push_back(handle);
+}
+
+void Scheduler::resume(Task::Handle handle) {
+    handle.resume();
+    if (!handle.done()) return;
+
+    std::exception_ptr exception = handle.promise().exception;
+    unlink(handle.promise());
+    handle.destroy();
+
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+void Scheduler::unlink(Task::promise_type& promise) {
+    if (promise.prev) promise.prev->next = promise.next;
+    else m_head = promise.next;
+    if (promise.next) promise.next->prev = promise.prev;
+    promise.prev = promise.next = nullptr;
+    --m_count;
+}
+
+} // namespace Engine
@@ -0,0 +1,53 @@
+#include "Example/Animation/AnimationLibrary.hpp"
+#include <stdexcept>
+#include <utility>
+
+namespace Example {
+
+ClipId AnimationLibrary::add(const std::string& name,
+                             std::vector<sf::IntRect> frames,
+                             float frameDuration,
+                             bool looping) {
+    if (frames.empty()) {
+        throw std::runtime_error("AnimationLibrary: Clip has no frames -> " + name);
+    }
+    if (!(frameDuration > 0.f)) {
+        throw std::runtime_error("AnimationLibrary: Frame duration must be positive -> " + name);
+    }
+    const auto id = static_cast<ClipId>(m_clips.size());
+    if (!m_ids.emplace(name, id).second) {
+        throw std::runtime_error("AnimationLibrary: Duplicate clip -> " + name);
+    }
+    m_clips.push_back(AnimationClip{std::move(frames), frameDuration, looping, id, name});
+    return id;
+}
+
+ClipId AnimationLibrary::find(std::string_view name) const {
+    auto it = m_ids.find(name);
+    return it == m_ids.end() ? InvalidClip : it->second;
+}
+
+ClipId AnimationLibrary::getId(std::string_view name) const {
+    const ClipId id = find(name);
+    if (id == InvalidClip) {
+        throw std::runtime_error("AnimationLibrary: Clip not found -> " + std::string(name));
+    }
+    return id;
+}
+
+const AnimationClip& AnimationLibrary::get(ClipId id) const {
+    if (id >= m_clips.size()) {
+        throw std::runtime_error("AnimationLibrary: Invalid clip id -> " + std::to_string(id));
+    }
+    return m_clips[id];
+}
+
+bool AnimationLibrary::contains(std::string_view name) const {
+    return m_ids.find(name) != m_ids.end();
+}
+
+std::size_t AnimationLibrary::size() const {
+    return m_clips.size();
+}
+
+} // namespace Example
@@ -2,18 +2,11 @@
 
 namespace Example {
 
-void SpriteAnimator::addAnimation(const std::string& name,
-                                   const std::vector<sf::IntRect>& frames,
-                                   float frameDuration,
-                                   bool looping) {
-    m_animations[name] = Animation{frames, frameDuration, looping};
-}
-
-void SpriteAnimator::play(const std::string& name) {
-    if (m_current == name && m_playing) {
+void SpriteAnimator::play(const AnimationClip& clip) {
+    if (m_clip == &clip && m_playing) {
         return; // Already playing this animation
     }
-    m_current = name;
+    m_clip = &clip;
     m_frameIndex = 0;
     m_elapsed = 0.f;
     m_playing = true;
@@ -25,27 +18,23 @@ void SpriteAnimator::stop() {
 }
 
 void SpriteAnimator::update(float dt) {
-    if (!m_playing || m_current.empty()) {
+    if (!m_playing || !m_clip) {
         return;
     }
 
-    auto it = m_animations.find(m_current);
-    if (it == m_animations.end() || it->second.frames.empty()) {
-        return;
-    }
-
-    const Animation& anim = it->second;
+    const AnimationClip& clip = *m_clip;
+    const auto frameCount = static_cast<std::uint32_t>(clip.frames.size());
     m_elapsed += dt;
 
-    while (m_elapsed >= anim.frameDuration) {
-        m_elapsed -= anim.frameDuration;
+    while (m_elapsed >= clip.frameDuration) {
+        m_elapsed -= clip.frameDuration;
         m_frameIndex++;
 
-        if (m_frameIndex >= anim.frames.size()) {
-            if (anim.looping) {
+        if (m_frameIndex >= frameCount) {
+            if (clip.looping) {
                 m_frameIndex = 0;
             } else {
-                m_frameIndex = anim.frames.size() - 1;
+                m_frameIndex = frameCount - 1;
                 m_playing = false;
                 m_finished = true;
                 break;
@@ -55,24 +44,26 @@ void SpriteAnimator::update(float dt) {
 }
 
 void SpriteAnimator::applyToSprite(sf::Sprite& sprite) const {
-    if (m_current.empty()) {
+    if (!m_clip) {
         return;
     }
-
-    auto it = m_animations.find(m_current);
-    if (it == m_animations.end() || it->second.frames.empty()) {
-        return;
-    }
-
-    sprite.setTextureRect(it->second.frames[m_frameIndex]);
+    sprite.setTextureRect(m_clip->frames[m_frameIndex]);
 }
 
 bool SpriteAnimator::isFinished() const {
     return m_finished;
 }
 
-const std::string& SpriteAnimator::currentAnimation() const {
-    return m_current;
+bool SpriteAnimator::isPlaying() const {
+    return m_playing;
+}
+
+const AnimationClip* SpriteAnimator::currentClip() const {
+    return m_clip;
+}
+
+ClipId SpriteAnimator::currentClipId() const {
+    return m_clip ? m_clip->id : InvalidClip;
 }
 
 std::size_t SpriteAnimator::currentFrame() const {
@@ -6,12 +6,22 @@ DemoScene::DemoScene(Engine::Context& ctx)
     : m_ctx(ctx) {
 }
 
+DemoScene::~DemoScene() {
+    m_ctx.interpolation.remove(m_body);
+}
+
 void DemoScene::init() {
     // Set up the player shape
     m_player = sf::CircleShape(30.f);
     m_player.setFillColor(sf::Color::Cyan);
     m_player.setOrigin({30.f, 30.f});
-    m_player.setPosition({640.f, 360.f});
+    m_player.setPosition(m_position);
+
+    // The engine blends the previous and current tick's position before draw()
+    m_body = m_ctx.interpolation.add(m_position);
+
+    // Behaviours run on the scene's scheduler and cost nothing while waiting
+    scheduler().start(pulse());
 
     // Bind input actions -- game code uses logical names, not raw keys.
     // This makes rebinding trivial (just change the binding, not the logic).
@@ -24,6 +34,22 @@ void DemoScene::init() {
     m_ctx.input.bindKey("move_right", sf::Keyboard::Key::D);
     m_ctx.input.bindKey("move_right", sf::Keyboard::Key::Right);
     m_ctx.input.bindKey("quit",       sf::Keyboard::Key::Escape);
+    m_ctx.input.bindKey("toggle_stats", sf::Keyboard::Key::F3);
+
+    // Renderer statistics overlay (hidden until F3 is pressed)
+    if (m_font.openFromFile("assets/fonts/default.ttf")) {
+        m_statsHud.emplace(m_ctx.renderStats, m_font);
+        m_statsHud->setVisible(false);
+    }
+}
+
+Engine::Task DemoScene::pulse() {
+    for (;;) {
+        m_player.setFillColor(sf::Color::Cyan);
+        co_await Engine::waitSeconds(1.f);
+        m_player.setFillColor(sf::Color(0, 170, 210));
+        co_await Engine::waitSeconds(1.f);
+    }
 }
 
 void DemoScene::handleInput([[maybe_unused]] float dt) {
@@ -34,6 +60,10 @@ void DemoScene::handleInput([[maybe_unused]] float dt) {
         return;
     }
 
+    if (m_statsHud && m_ctx.input.isActionPressed("toggle_stats")) {
+        m_statsHud->setVisible(!m_statsHud->isVisible());
+    }
+
     // Compute movement direction from action bindings
     m_velocity = {0.f, 0.f};
 
@@ -57,9 +87,21 @@ void DemoScene::handleInput([[maybe_unused]] float dt) {
 }
 
 void DemoScene::update(float dt) {
-    m_player.move(m_velocity * Speed * dt);
+    m_position += m_velocity * Speed * dt;
+    m_ctx.interpolation.set(m_body, m_position);
+
+    if (m_statsHud) {
+        m_statsHud->update(dt);
+    }
 }
 
 void DemoScene::draw([[maybe_unused]] float interpolation) {
+    // Already blended by the Application; no per-object lerp needed here
+    m_player.setPosition(m_ctx.interpolation.getPosition(m_body));
     m_ctx.renderer.draw(m_player);
+
+    if (m_statsHud && m_statsHud->isVisible()) {
+        m_ctx.renderer.setView(m_ctx.renderer.getDefaultView());
+        m_statsHud->draw(m_ctx.renderer);
+    }
 }
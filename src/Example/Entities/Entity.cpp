@@ -1,45 +1,131 @@
 #include "Example/Entities/Entity.hpp"
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace Example {
 
+Entity::Entity()
+    : Entity(sharedRegistry()) {
+}
+
 Entity::Entity(sf::Vector2f position, sf::Vector2f size)
-    : m_position(position), m_size(size) {
+    : Entity(sharedRegistry(), position, size) {
+}
+
+Entity::Entity(Engine::Registry& registry, sf::Vector2f position, sf::Vector2f size)
+    : m_registry(&registry), m_id(registry.create()) {
+    registry.emplace<Engine::Position>(m_id, position);
+    registry.emplace<Engine::Velocity>(m_id);
+    registry.emplace<Engine::Size>(m_id, size);
+    bindPools();
+}
+
+Entity::~Entity() {
+    release();
+}
+
+Entity::Entity(const Entity& other)
+    : Entity(other.getRegistry(), other.getPosition(), other.getSize()) {
+    setVelocity(other.getVelocity());
+    m_alive = other.m_alive;
+}
+
+Entity& Entity::operator=(const Entity& other) {
+    if (this != &other) {
+        // Read first: throws before anything changes if other was moved from
+        Engine::Registry& registry = other.getRegistry();
+        const sf::Vector2f position = other.getPosition();
+        const sf::Vector2f velocity = other.getVelocity();
+        const sf::Vector2f size = other.getSize();
+
+        if (m_registry != &registry) {
+            release();
+            m_registry = &registry;
+            m_id = registry.create();
+        }
+        m_registry->emplace<Engine::Position>(m_id, position);
+        m_registry->emplace<Engine::Velocity>(m_id, velocity);
+        m_registry->emplace<Engine::Size>(m_id, size);
+        m_alive = other.m_alive;
+        bindPools();
+    }
+    return *this;
+}
+
+Entity::Entity(Entity&& other) noexcept
+    : m_registry(std::exchange(other.m_registry, nullptr))
+    , m_id(std::exchange(other.m_id, Engine::NullEntity))
+    , m_alive(other.m_alive)
+    , m_positions(std::exchange(other.m_positions, nullptr))
+    , m_velocities(std::exchange(other.m_velocities, nullptr))
+    , m_sizes(std::exchange(other.m_sizes, nullptr)) {
+}
+
+Entity& Entity::operator=(Entity&& other) noexcept {
+    if (this != &other) {
+        release();
+        m_registry = std::exchange(other.m_registry, nullptr);
+        m_id = std::exchange(other.m_id, Engine::NullEntity);
+        m_alive = other.m_alive;
+        m_positions = std::exchange(other.m_positions, nullptr);
+        m_velocities = std::exchange(other.m_velocities, nullptr);
+        m_sizes = std::exchange(other.m_sizes, nullptr);
+    }
+    return *this;
+}
+
+template <typename Component>
+Component& Entity::component() const {
+    Engine::ComponentPool<Component>* pool;
+    if constexpr (std::is_same_v<Component, Engine::Position>) {
+        pool = m_positions;
+    } else if constexpr (std::is_same_v<Component, Engine::Velocity>) {
+        pool = m_velocities;
+    } else {
+        static_assert(std::is_same_v<Component, Engine::Size>, "Entity: No cached pool for this component");
+        pool = m_sizes;
+    }
+    if (!pool) {
+        throw std::runtime_error("Entity: Used after move -> no components");
+    }
+    return pool->get(m_id);
 }
 
 void Entity::update(float dt) {
-    m_position += m_velocity * dt;
+    component<Engine::Position>().value += component<Engine::Velocity>().value * dt;
 }
 
 void Entity::setPosition(sf::Vector2f pos) {
-    m_position = pos;
+    component<Engine::Position>().value = pos;
 }
 
 void Entity::move(sf::Vector2f offset) {
-    m_position += offset;
+    component<Engine::Position>().value += offset;
 }
 
 sf::Vector2f Entity::getPosition() const {
-    return m_position;
+    return component<Engine::Position>().value;
 }
 
 void Entity::setVelocity(sf::Vector2f vel) {
-    m_velocity = vel;
+    component<Engine::Velocity>().value = vel;
 }
 
 sf::Vector2f Entity::getVelocity() const {
-    return m_velocity;
+    return component<Engine::Velocity>().value;
 }
 
 void Entity::setSize(sf::Vector2f size) {
-    m_size = size;
+    component<Engine::Size>().value = size;
 }
 
 sf::Vector2f Entity::getSize() const {
-    return m_size;
+    return component<Engine::Size>().value;
 }
 
 sf::FloatRect Entity::getBounds() const {
-    return sf::FloatRect(m_position, m_size);
+    return sf::FloatRect(getPosition(), getSize());
 }
 
 void Entity::setAlive(bool alive) {
@@ -50,4 +136,45 @@ bool Entity::isAlive() const {
     return m_alive;
 }
 
+Engine::EntityId Entity::getId() const {
+    return m_id;
+}
+
+Engine::Registry& Entity::getRegistry() const {
+    if (!m_registry) {
+        throw std::runtime_error("Entity: Used after move -> no registry");
+    }
+    return *m_registry;
+}
+
+Engine::Registry& Entity::sharedRegistry() {
+    static Engine::Registry registry;
+    return registry;
+}
+
+sf::Vector2f& Entity::position() {
+    return component<Engine::Position>().value;
+}
+
+sf::Vector2f& Entity::velocity() {
+    return component<Engine::Velocity>().value;
+}
+
+sf::Vector2f& Entity::size() {
+    return component<Engine::Size>().value;
+}
+
+void Entity::bindPools() {
+    m_positions = m_registry ? &m_registry->storage<Engine::Position>() : nullptr;
+    m_velocities = m_registry ? &m_registry->storage<Engine::Velocity>() : nullptr;
+    m_sizes = m_registry ? &m_registry->storage<Engine::Size>() : nullptr;
+}
+
+void Entity::release() {
+    if (m_registry && m_id != Engine::NullEntity) {
+        m_registry->destroy(m_id);
+        m_id = Engine::NullEntity;
+    }
+}
+
 } // namespace Example
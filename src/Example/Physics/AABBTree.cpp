@@ -0,0 +1,298 @@
+#include "Example/Physics/AABBTree.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace Example {
+
+namespace {
+
+/// The fat bounds are stretched by this multiple of the predicted displacement.
+constexpr float DisplacementMultiplier = 2.f;
+
+} // namespace
+
+AABBTree::AABBTree(float margin)
+    : m_margin(std::max(margin, 0.f)) {
+}
+
+AABBTree::ProxyId AABBTree::add(const sf::FloatRect& bounds, std::uint32_t userData) {
+    const ProxyId id = allocateNode();
+    Node& node = m_nodes[id];
+    node.tight = toBox(bounds);
+    node.fat = {node.tight.minX - m_margin, node.tight.minY - m_margin,
+                node.tight.maxX + m_margin, node.tight.maxY + m_margin};
+    node.height = 0;
+    node.userData = userData;
+
+    insertLeaf(id);
+    ++m_proxyCount;
+    return id;
+}
+
+void AABBTree::remove(ProxyId id) {
+    static_cast<void>(leaf(id)); // Validate
+    removeLeaf(id);
+    freeNode(id);
+    --m_proxyCount;
+}
+
+bool AABBTree::move(ProxyId id, const sf::FloatRect& bounds, sf::Vector2f displacement) {
+    static_cast<void>(leaf(id)); // Validate
+    Node& node = m_nodes[id];
+    node.tight = toBox(bounds);
+    if (encloses(node.fat, node.tight)) {
+        return false;
+    }
+
+    // Re-insert with bounds fattened by the margin and stretched along the
+    // predicted displacement, so the next few moves stay inside
+    Box fat{node.tight.minX - m_margin, node.tight.minY - m_margin,
+            node.tight.maxX + m_margin, node.tight.maxY + m_margin};
+    const sf::Vector2f d = displacement * DisplacementMultiplier;
+    (d.x < 0.f ? fat.minX : fat.maxX) += d.x;
+    (d.y < 0.f ? fat.minY : fat.maxY) += d.y;
+
+    removeLeaf(id);
+    m_nodes[id].fat = fat;
+    insertLeaf(id);
+    return true;
+}
+
+sf::FloatRect AABBTree::getBounds(ProxyId id) const {
+    return toRect(leaf(id).tight);
+}
+
+sf::FloatRect AABBTree::getFatBounds(ProxyId id) const {
+    return toRect(leaf(id).fat);
+}
+
+std::uint32_t AABBTree::getUserData(ProxyId id) const {
+    return leaf(id).userData;
+}
+
+bool AABBTree::isValid(ProxyId id) const {
+    return id < m_nodes.size() && m_nodes[id].height == 0;
+}
+
+std::size_t AABBTree::size() const {
+    return m_proxyCount;
+}
+
+int AABBTree::getHeight() const {
+    return m_root == Null ? 0 : m_nodes[m_root].height + 1;
+}
+
+void AABBTree::clear() {
+    m_nodes.clear();
+    m_root = Null;
+    m_freeList = Null;
+    m_proxyCount = 0;
+}
+
+AABBTree::ProxyId AABBTree::allocateNode() {
+    if (m_freeList == Null) {
+        m_nodes.emplace_back();
+        return static_cast<ProxyId>(m_nodes.size() - 1);
+    }
+    const ProxyId id = m_freeList;
+    m_freeList = m_nodes[id].parent;
+    m_nodes[id] = Node{};
+    return id;
+}
+
+void AABBTree::freeNode(ProxyId id) {
+    Node& node = m_nodes[id];
+    node.parent = m_freeList;
+    node.child1 = node.child2 = Null;
+    node.height = -1;
+    m_freeList = id;
+}
+
+void AABBTree::insertLeaf(ProxyId leafId) {
+    m_nodes[leafId].parent = Null;
+    if (m_root == Null) {
+        m_root = leafId;
+        return;
+    }
+
+    // Descend to the sibling that grows the total perimeter least: pairing
+    // with the current node costs its new union; descending costs the
+    // growth of this node plus the cheapest growth of a child.
+    const Box leafBox = m_nodes[leafId].fat;
+    ProxyId index = m_root;
+    while (!m_nodes[index].isLeaf()) {
+        const Node& node = m_nodes[index];
+        const float area = perimeter(node.fat);
+        const float combinedArea = perimeter(combine(node.fat, leafBox));
+
+        const float cost = 2.f * combinedArea;
+        const float inheritance = 2.f * (combinedArea - area);
+
+        const auto childCost = [&](ProxyId child) {
+            const Node& c = m_nodes[child];
+            const float grown = perimeter(combine(c.fat, leafBox));
+            return c.isLeaf() ? grown + inheritance : grown - perimeter(c.fat) + inheritance;
+        };
+        const float cost1 = childCost(node.child1);
+        const float cost2 = childCost(node.child2);
+
+        if (cost < cost1 && cost < cost2) break;
+        index = cost1 < cost2 ? node.child1 : node.child2;
+    }
+    const ProxyId sibling = index;
+
+    // New parent joins the sibling and the leaf
+    const ProxyId oldParent = m_nodes[sibling].parent;
+    const ProxyId newParent = allocateNode();
+    {
+        Node& parent = m_nodes[newParent];
+        parent.parent = oldParent;
+        parent.fat = combine(leafBox, m_nodes[sibling].fat);
+        parent.height = m_nodes[sibling].height + 1;
+        parent.child1 = sibling;
+        parent.child2 = leafId;
+    }
+
+    if (oldParent != Null) {
+        Node& old = m_nodes[oldParent];
+        (old.child1 == sibling ? old.child1 : old.child2) = newParent;
+    } else {
+        m_root = newParent;
+    }
+    m_nodes[sibling].parent = newParent;
+    m_nodes[leafId].parent = newParent;
+
+    // Walk back up, rebalancing and refitting
+    index = m_nodes[leafId].parent;
+    while (index != Null) {
+        index = balance(index);
+        Node& node = m_nodes[index];
+        const Node& child1 = m_nodes[node.child1];
+        const Node& child2 = m_nodes[node.child2];
+        node.height = 1 + std::max(child1.height, child2.height);
+        node.fat = combine(child1.fat, child2.fat);
+        index = node.parent;
+    }
+}
+
+void AABBTree::removeLeaf(ProxyId leafId) {
+    if (leafId == m_root) {
+        m_root = Null;
+        return;
+    }
+
+    const ProxyId parent = m_nodes[leafId].parent;
+    const ProxyId grandParent = m_nodes[parent].parent;
+    const ProxyId sibling = m_nodes[parent].child1 == leafId ? m_nodes[parent].child2
+                                                             : m_nodes[parent].child1;
+
+    if (grandParent == Null) {
+        m_root = sibling;
+        m_nodes[sibling].parent = Null;
+        freeNode(parent);
+        return;
+    }
+
+    // Replace the parent by the sibling, then refit the ancestors
+    Node& grand = m_nodes[grandParent];
+    (grand.child1 == parent ? grand.child1 : grand.child2) = sibling;
+    m_nodes[sibling].parent = grandParent;
+    freeNode(parent);
+
+    ProxyId index = grandParent;
+    while (index != Null) {
+        index = balance(index);
+        Node& node = m_nodes[index];
+        const Node& child1 = m_nodes[node.child1];
+        const Node& child2 = m_nodes[node.child2];
+        node.fat = combine(child1.fat, child2.fat);
+        node.height = 1 + std::max(child1.height, child2.height);
+        index = node.parent;
+    }
+}
+
+AABBTree::ProxyId AABBTree::balance(ProxyId iA) {
+    // AVL rotation: if one child of A is more than one level taller than
+    // the other, the taller child C becomes A's parent, and C's taller
+    // child stays under C. Returns the node now at A's position.
+    Node& A = m_nodes[iA];
+    if (A.isLeaf() || A.height < 2) return iA;
+
+    const ProxyId iB = A.child1;
+    const ProxyId iC = A.child2;
+    const int difference = m_nodes[iC].height - m_nodes[iB].height;
+    if (difference >= -1 && difference <= 1) return iA;
+
+    // Rotate the taller child up; the logic is symmetric, so name the
+    // taller child "up" and the other "down"
+    const bool rotateC = difference > 1;
+    const ProxyId iUp = rotateC ? iC : iB;
+    const ProxyId iDown = rotateC ? iB : iC;
+    Node& up = m_nodes[iUp];
+    const ProxyId iF = up.child1;
+    const ProxyId iG = up.child2;
+    Node& F = m_nodes[iF];
+    Node& G = m_nodes[iG];
+
+    // Up takes A's place
+    up.child1 = iA;
+    up.parent = A.parent;
+    A.parent = iUp;
+    if (up.parent != Null) {
+        Node& parent = m_nodes[up.parent];
+        (parent.child1 == iA ? parent.child1 : parent.child2) = iUp;
+    } else {
+        m_root = iUp;
+    }
+
+    // The taller grandchild stays under Up; the shorter one moves under A
+    const bool keepF = F.height > G.height;
+    const ProxyId iKeep = keepF ? iF : iG;
+    const ProxyId iMove = keepF ? iG : iF;
+    Node& moved = m_nodes[iMove];
+    const Node& down = m_nodes[iDown];
+
+    up.child2 = iKeep;
+    (rotateC ? A.child2 : A.child1) = iMove;
+    moved.parent = iA;
+
+    A.fat = combine(down.fat, moved.fat);
+    A.height = 1 + std::max(down.height, moved.height);
+    up.fat = combine(A.fat, m_nodes[iKeep].fat);
+    up.height = 1 + std::max(A.height, m_nodes[iKeep].height);
+    return iUp;
+}
+
+const AABBTree::Node& AABBTree::leaf(ProxyId id) const {
+    if (!isValid(id)) {
+        throw std::runtime_error("AABBTree: Invalid proxy -> " + std::to_string(id));
+    }
+    return m_nodes[id];
+}
+
+AABBTree::Box AABBTree::toBox(const sf::FloatRect& rect) {
+    return {rect.position.x, rect.position.y,
+            rect.position.x + rect.size.x, rect.position.y + rect.size.y};
+}
+
+sf::FloatRect AABBTree::toRect(const Box& box) {
+    return sf::FloatRect({box.minX, box.minY}, {box.maxX - box.minX, box.maxY - box.minY});
+}
+
+AABBTree::Box AABBTree::combine(const Box& a, const Box& b) {
+    return {std::min(a.minX, b.minX), std::min(a.minY, b.minY),
+            std::max(a.maxX, b.maxX), std::max(a.maxY, b.maxY)};
+}
+
+float AABBTree::perimeter(const Box& box) {
+    return 2.f * ((box.maxX - box.minX) + (box.maxY - box.minY));
+}
+
+bool AABBTree::encloses(const Box& outer, const Box& inner) {
+    return outer.minX <= inner.minX && outer.minY <= inner.minY
+        && inner.maxX <= outer.maxX && inner.maxY <= outer.maxY;
+}
+
+} // namespace Example
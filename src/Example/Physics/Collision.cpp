@@ -1,8 +1,68 @@
 #include "Example/Physics/Collision.hpp"
 #include <algorithm>
+#include <bit>
 #include <cmath>
+#include <limits>
+#include <type_traits>
 
-namespace Example::Collision {
+#if defined(__x86_64__) || defined(_M_X64)
+    #define EXAMPLE_COLLISION_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define EXAMPLE_COLLISION_SSE2 0
+#endif
+
+namespace Example {
+
+void LayerPairStats::clear() {
+    pairs.fill(0);
+    total = 0;
+    filtered = 0;
+}
+
+void LayerPairStats::record(const CollisionFilter& a, const CollisionFilter& b) {
+    ++total;
+    for (std::uint32_t layers = a.category | b.category; layers != 0; layers &= layers - 1) {
+        ++pairs[static_cast<std::size_t>(std::countr_zero(layers))];
+    }
+}
+
+std::size_t AABBBatch::add(const sf::FloatRect& rect) {
+    m_centerX.emplace_back();
+    m_centerY.emplace_back();
+    m_halfWidth.emplace_back();
+    m_halfHeight.emplace_back();
+    set(m_centerX.size() - 1, rect);
+    return m_centerX.size() - 1;
+}
+
+void AABBBatch::set(std::size_t index, const sf::FloatRect& rect) {
+    // Same expressions as checkAABB(), so the batch test sees the same values
+    m_centerX[index] = rect.position.x + rect.size.x / 2.f;
+    m_centerY[index] = rect.position.y + rect.size.y / 2.f;
+    m_halfWidth[index] = rect.size.x / 2.f;
+    m_halfHeight[index] = rect.size.y / 2.f;
+}
+
+void AABBBatch::clear() {
+    m_centerX.clear();
+    m_centerY.clear();
+    m_halfWidth.clear();
+    m_halfHeight.clear();
+}
+
+void AABBBatch::reserve(std::size_t count) {
+    m_centerX.reserve(count);
+    m_centerY.reserve(count);
+    m_halfWidth.reserve(count);
+    m_halfHeight.reserve(count);
+}
+
+std::size_t AABBBatch::size() const {
+    return m_centerX.size();
+}
+
+namespace Collision {
 
 CollisionResult checkAABB(const sf::FloatRect& a, const sf::FloatRect& b) {
     CollisionResult result;
@@ -42,6 +102,182 @@ CollisionResult checkAABB(const sf::FloatRect& a, const sf::FloatRect& b) {
     return result;
 }
 
+void checkAABB(const sf::FloatRect& a, const AABBBatch& batch, BatchCollisionResult& out) {
+    const std::size_t count = batch.size();
+    out.hits.assign((count + 63) / 64, 0);
+    out.overlaps.resize(count);
+    out.count = 0;
+
+    const float ax = a.position.x + a.size.x / 2.f;
+    const float ay = a.position.y + a.size.y / 2.f;
+    const float halfWidthA = a.size.x / 2.f;
+    const float halfHeightA = a.size.y / 2.f;
+
+    const float* bx = batch.centerX();
+    const float* by = batch.centerY();
+    const float* halfWidthB = batch.halfWidth();
+    const float* halfHeightB = batch.halfHeight();
+
+    std::size_t i = 0;
+#if EXAMPLE_COLLISION_SSE2
+    const __m128 vax = _mm_set1_ps(ax);
+    const __m128 vay = _mm_set1_ps(ay);
+    const __m128 vhwa = _mm_set1_ps(halfWidthA);
+    const __m128 vhha = _mm_set1_ps(halfHeightA);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 sign = _mm_set1_ps(-0.f);
+
+    // Written as interleaved x, y floats; data() is null for an empty batch
+    static_assert(sizeof(sf::Vector2f) == 2 * sizeof(float) && std::is_standard_layout_v<sf::Vector2f>);
+    float* overlaps = reinterpret_cast<float*>(out.overlaps.data());
+    for (; i + 4 <= count; i += 4) {
+        const __m128 dx = _mm_sub_ps(_mm_loadu_ps(bx + i), vax);
+        const __m128 dy = _mm_sub_ps(_mm_loadu_ps(by + i), vay);
+        const __m128 overlapX = _mm_sub_ps(_mm_add_ps(vhwa, _mm_loadu_ps(halfWidthB + i)),
+                                           _mm_andnot_ps(sign, dx));
+        const __m128 overlapY = _mm_sub_ps(_mm_add_ps(vhha, _mm_loadu_ps(halfHeightB + i)),
+                                           _mm_andnot_ps(sign, dy));
+
+        // "Not <= 0" rather than "> 0": a NaN overlap collides, as in the scalar test
+        const __m128 colliding = _mm_and_ps(_mm_cmpnle_ps(overlapX, zero),
+                                            _mm_cmpnle_ps(overlapY, zero));
+        const __m128 alongX = _mm_cmplt_ps(overlapX, overlapY);
+
+        // Negate (flip the sign bit) unless the delta is positive
+        const __m128 signedX = _mm_xor_ps(overlapX, _mm_andnot_ps(_mm_cmpgt_ps(dx, zero), sign));
+        const __m128 signedY = _mm_xor_ps(overlapY, _mm_andnot_ps(_mm_cmpgt_ps(dy, zero), sign));
+        const __m128 resultX = _mm_and_ps(signedX, _mm_and_ps(colliding, alongX));
+        const __m128 resultY = _mm_and_ps(signedY, _mm_andnot_ps(alongX, colliding));
+
+        _mm_storeu_ps(overlaps + 2 * i, _mm_unpacklo_ps(resultX, resultY));
+        _mm_storeu_ps(overlaps + 2 * i + 4, _mm_unpackhi_ps(resultX, resultY));
+
+        const auto mask = static_cast<std::uint64_t>(_mm_movemask_ps(colliding));
+        out.hits[i / 64] |= mask << (i % 64);
+        out.count += static_cast<std::size_t>(std::popcount(mask));
+    }
+#endif
+
+    // Scalar path, or the tail the vector loop could not fill
+    for (; i < count; ++i) {
+        const float dx = bx[i] - ax;
+        const float dy = by[i] - ay;
+        const float overlapX = halfWidthA + halfWidthB[i] - std::abs(dx);
+        const float overlapY = halfHeightA + halfHeightB[i] - std::abs(dy);
+
+        sf::Vector2f& overlap = out.overlaps[i];
+        overlap = {0.f, 0.f};
+        if (overlapX <= 0.f || overlapY <= 0.f) continue;
+
+        out.hits[i / 64] |= std::uint64_t{1} << (i % 64);
+        ++out.count;
+        if (overlapX < overlapY) {
+            overlap.x = (dx > 0.f) ? overlapX : -overlapX;
+        } else {
+            overlap.y = (dy > 0.f) ? overlapY : -overlapY;
+        }
+    }
+}
+
+namespace {
+
+/// Times (fractions of `delta`) at which the interval [minA, maxA] moving
+/// by `delta` starts and stops overlapping [minB, maxB]. Returns false when
+/// it never overlaps during the move.
+bool sweepAxis(float minA, float maxA, float minB, float maxB, float delta,
+               float& entry, float& exit) {
+    if (delta > 0.f) {
+        entry = (minB - maxA) / delta;
+        exit = (maxB - minA) / delta;
+    } else if (delta < 0.f) {
+        entry = (maxB - minA) / delta;
+        exit = (minB - maxA) / delta;
+    } else {
+        // Not moving on this axis: overlapping the whole time, or never
+        if (maxA <= minB || minA >= maxB) return false;
+        entry = -std::numeric_limits<float>::infinity();
+        exit = std::numeric_limits<float>::infinity();
+    }
+    return true;
+}
+
+} // namespace
+
+SweepResult sweepAABB(const sf::FloatRect& moving, sf::Vector2f displacement,
+                      const sf::FloatRect& obstacle) {
+    SweepResult result;
+    result.position = moving.position + displacement;
+
+    const CollisionResult overlap = checkAABB(moving, obstacle);
+    if (overlap.colliding) {
+        // Already inside: contact at the start, pushed out along the MTV
+        // axis, but only while moving further in. Moving out (or along the
+        // face) is left to the sweep below, which finds no later entry, so
+        // overlapping bodies can separate
+        const sf::Vector2f normal{overlap.overlap.x > 0.f ? -1.f : (overlap.overlap.x < 0.f ? 1.f : 0.f),
+                                  overlap.overlap.y > 0.f ? -1.f : (overlap.overlap.y < 0.f ? 1.f : 0.f)};
+        if (displacement.x * normal.x + displacement.y * normal.y < 0.f) {
+            result.hit = true;
+            result.time = 0.f;
+            result.normal = normal;
+            result.position = moving.position;
+            result.remaining = displacement;
+            return result;
+        }
+    }
+
+    float entryX, exitX, entryY, exitY;
+    if (!sweepAxis(moving.position.x, moving.position.x + moving.size.x,
+                   obstacle.position.x, obstacle.position.x + obstacle.size.x,
+                   displacement.x, entryX, exitX)
+        || !sweepAxis(moving.position.y, moving.position.y + moving.size.y,
+                      obstacle.position.y, obstacle.position.y + obstacle.size.y,
+                      displacement.y, entryY, exitY)) {
+        return result;
+    }
+
+    // Contact starts once both axes overlap and must begin before either
+    // stops; reaching the obstacle exactly at the end of the move is only
+    // touching, not a hit
+    const float entry = std::max(entryX, entryY);
+    const float exit = std::min(exitX, exitY);
+    if (entry >= exit || entry < 0.f || entry >= 1.f) {
+        return result;
+    }
+
+    result.hit = true;
+    result.time = entry;
+    if (entryX > entryY) {
+        result.normal.x = displacement.x > 0.f ? -1.f : 1.f;
+    } else {
+        result.normal.y = displacement.y > 0.f ? -1.f : 1.f;
+    }
+    result.position = moving.position + displacement * entry;
+    result.remaining = displacement * (1.f - entry);
+    return result;
+}
+
+SweepResult sweepAABB(const sf::FloatRect& moving, sf::Vector2f displacement,
+                      std::span<const sf::FloatRect> obstacles, std::size_t* hitIndex) {
+    SweepResult best;
+    best.position = moving.position + displacement;
+    for (std::size_t i = 0; i < obstacles.size(); ++i) {
+        const SweepResult result = sweepAABB(moving, displacement, obstacles[i]);
+        if (result.hit && (!best.hit || result.time < best.time)) {
+            best = result;
+            if (hitIndex) *hitIndex = i;
+        }
+    }
+    return best;
+}
+
+sf::FloatRect sweptBounds(const sf::FloatRect& rect, sf::Vector2f displacement) {
+    const sf::Vector2f min{rect.position.x + std::min(displacement.x, 0.f),
+                           rect.position.y + std::min(displacement.y, 0.f)};
+    return sf::FloatRect(min, {rect.size.x + std::abs(displacement.x),
+                               rect.size.y + std::abs(displacement.y)});
+}
+
 bool intersects(const sf::FloatRect& a, const sf::FloatRect& b) {
     return a.findIntersection(b).has_value();
 }
@@ -50,4 +286,5 @@ bool contains(sf::Vector2f point, const sf::FloatRect& rect) {
     return rect.contains(point);
 }
 
-} // namespace Example::Collision
+} // namespace Collision
+} // namespace Example
@@ -0,0 +1,180 @@
+#include "Example/Physics/ContactCache.hpp"
+#include <optional>
+#include <utility>
+
+namespace Example {
+
+ContactCache::ContactCache(Engine::EventBus& events)
+    : m_events(&events) {
+}
+
+void ContactCache::beginStep() {
+    m_seen.assign(m_contacts.size(), false);
+    m_tested = 0;
+    m_skipped = 0;
+}
+
+CollisionResult ContactCache::update(Engine::EntityId a, const sf::FloatRect& boundsA,
+                                     Engine::EntityId b, const sf::FloatRect& boundsB) {
+    // Stored with the lower index first; flip the result back on return
+    const bool swapped = b.index < a.index;
+    if (swapped) {
+        std::swap(a, b);
+    }
+    const sf::FloatRect& lowerBounds = swapped ? boundsB : boundsA;
+    const sf::FloatRect& upperBounds = swapped ? boundsA : boundsB;
+
+    // Events go out last, once the cache is consistent: handlers may remove()
+    std::optional<ContactEnd> ended;
+    std::optional<ContactBegin> began;
+    std::optional<ContactStay> stayed;
+
+    const std::uint64_t key = pairKey(a, b);
+    auto it = m_index.find(key);
+    if (it != m_index.end()) {
+        const ContactManifold& cached = m_contacts[it->second];
+        if (cached.a != a || cached.b != b) {
+            // Same slots, recycled entities: the old contact is over
+            if (cached.result.colliding) ended = ContactEnd{cached.a, cached.b};
+            erase(it->second);
+            it = m_index.end();
+        }
+    }
+
+    CollisionResult result;
+    if (it == m_index.end()) {
+        ++m_tested;
+        result = Collision::checkAABB(lowerBounds, upperBounds);
+        m_index.emplace(key, static_cast<std::uint32_t>(m_contacts.size()));
+        m_contacts.push_back({a, b, lowerBounds, upperBounds, result});
+        m_seen.push_back(true);
+        if (result.colliding) began = ContactBegin{a, b, result.overlap};
+    } else {
+        const std::uint32_t index = it->second;
+        ContactManifold& manifold = m_contacts[index];
+        m_seen[index] = true;
+
+        if (manifold.boundsA == lowerBounds && manifold.boundsB == upperBounds) {
+            ++m_skipped;
+            result = manifold.result;
+        } else {
+            ++m_tested;
+            result = Collision::checkAABB(lowerBounds, upperBounds);
+            const CollisionResult previous = manifold.result;
+            manifold.boundsA = lowerBounds;
+            manifold.boundsB = upperBounds;
+            manifold.result = result;
+
+            if (result.colliding && !previous.colliding) {
+                began = ContactBegin{a, b, result.overlap};
+            } else if (!result.colliding && previous.colliding) {
+                ended = ContactEnd{a, b};
+            } else if (result.colliding && result.overlap != previous.overlap) {
+                stayed = ContactStay{a, b, result.overlap};
+            }
+        }
+    }
+
+    if (ended) m_events->publish(*ended);
+    if (began) m_events->publish(*began);
+    if (stayed) m_events->publish(*stayed);
+
+    if (swapped) {
+        result.overlap = -result.overlap;
+    }
+    return result;
+}
+
+void ContactCache::endStep() {
+    // Backwards, so the entry swapped into i by erase() was already visited
+    for (std::size_t i = m_contacts.size(); i-- > 0;) {
+        if (m_seen[i]) continue;
+        if (m_contacts[i].result.colliding) {
+            m_ended.push_back({m_contacts[i].a, m_contacts[i].b});
+        }
+        erase(i);
+    }
+    publishEnded();
+}
+
+void ContactCache::remove(Engine::EntityId entity) {
+    for (std::size_t i = m_contacts.size(); i-- > 0;) {
+        const ContactManifold& manifold = m_contacts[i];
+        if (manifold.a != entity && manifold.b != entity) continue;
+        if (manifold.result.colliding) {
+            m_ended.push_back({manifold.a, manifold.b});
+        }
+        erase(i);
+    }
+    publishEnded();
+}
+
+const ContactManifold* ContactCache::find(Engine::EntityId a, Engine::EntityId b) const {
+    if (b.index < a.index) std::swap(a, b);
+    const auto it = m_index.find(pairKey(a, b));
+    if (it == m_index.end()) return nullptr;
+
+    const ContactManifold& manifold = m_contacts[it->second];
+    return manifold.a == a && manifold.b == b ? &manifold : nullptr;
+}
+
+bool ContactCache::isTouching(Engine::EntityId a, Engine::EntityId b) const {
+    const ContactManifold* manifold = find(a, b);
+    return manifold && manifold->result.colliding;
+}
+
+std::span<const ContactManifold> ContactCache::getContacts() const {
+    return m_contacts;
+}
+
+std::size_t ContactCache::getTestedCount() const {
+    return m_tested;
+}
+
+std::size_t ContactCache::getSkippedCount() const {
+    return m_skipped;
+}
+
+std::size_t ContactCache::size() const {
+    return m_contacts.size();
+}
+
+void ContactCache::clear() {
+    m_contacts.clear();
+    m_seen.clear();
+    m_index.clear();
+    m_ended.clear();
+}
+
+std::uint64_t ContactCache::pairKey(Engine::EntityId a, Engine::EntityId b) {
+    return (std::uint64_t{a.index} << 32) | b.index;
+}
+
+void ContactCache::erase(std::size_t index) {
+    const ContactManifold& manifold = m_contacts[index];
+    m_index.erase(pairKey(manifold.a, manifold.b));
+
+    const std::size_t last = m_contacts.size() - 1;
+    if (index != last) {
+        m_contacts[index] = m_contacts[last];
+        m_index[pairKey(m_contacts[index].a, m_contacts[index].b)] = static_cast<std::uint32_t>(index);
+        m_seen[index] = m_seen[last];
+    }
+    m_contacts.pop_back();
+    m_seen.pop_back();
+}
+
+void ContactCache::publishEnded() {
+    // Publish from a local list: a handler may call remove(), which refills m_ended
+    std::vector<ContactEnd> ended;
+    ended.swap(m_ended);
+    for (const ContactEnd& event : ended) {
+        m_events->publish(event);
+    }
+    ended.clear();
+    if (m_ended.empty()) {
+        m_ended.swap(ended); // Keep the capacity
+    }
+}
+
+} // namespace Example
@@ -0,0 +1,180 @@
+#include "Example/Physics/IslandSolver.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace Example {
+
+namespace {
+
+constexpr std::uint32_t None = std::numeric_limits<std::uint32_t>::max();
+
+/// Small islands are handed to threads in batches of at least this many
+/// pairs, so thousands of two-body islands do not cost a dispatch each.
+constexpr std::uint32_t MinBatchPairs = 128;
+
+} // namespace
+
+IslandSolver::IslandSolver(Engine::ThreadPool* pool)
+    : m_pool(pool) {
+}
+
+void IslandSolver::setThreadPool(Engine::ThreadPool* pool) {
+    m_pool = pool;
+}
+
+void IslandSolver::setIterations(int iterations) {
+    m_iterations = std::max(iterations, 1);
+}
+
+int IslandSolver::getIterations() const {
+    return m_iterations;
+}
+
+void IslandSolver::solve(std::span<sf::FloatRect> bounds, std::span<const float> inverseMasses,
+                         std::span<const CollisionPair> pairs) {
+    if (inverseMasses.size() != bounds.size()) {
+        throw std::runtime_error("IslandSolver: Inverse mass count mismatch -> "
+                                 + std::to_string(inverseMasses.size()));
+    }
+    const auto bodyCount = static_cast<std::uint32_t>(bounds.size());
+    const auto isDynamic = [&](std::uint32_t body) { return inverseMasses[body] > 0.f; };
+
+    // Connect dynamic bodies that share a pair
+    m_parent.resize(bodyCount);
+    for (std::uint32_t body = 0; body < bodyCount; ++body) {
+        m_parent[body] = body;
+    }
+    for (const CollisionPair& pair : pairs) {
+        if (isDynamic(pair.a) && isDynamic(pair.b)) {
+            unite(pair.a, pair.b);
+        }
+    }
+
+    // Number islands in order of their first pair, and count their pairs.
+    // A pair belongs to the island of its dynamic body (static-static pairs
+    // to none).
+    m_islandOfRoot.assign(bodyCount, None);
+    m_pairIsland.resize(pairs.size());
+    m_islandStart.assign(1, 0);
+    for (std::size_t i = 0; i < pairs.size(); ++i) {
+        const CollisionPair& pair = pairs[i];
+        const std::uint32_t body = isDynamic(pair.a) ? pair.a : (isDynamic(pair.b) ? pair.b : None);
+        if (body == None) {
+            m_pairIsland[i] = None;
+            continue;
+        }
+        std::uint32_t& island = m_islandOfRoot[find(body)];
+        if (island == None) {
+            island = static_cast<std::uint32_t>(m_islandStart.size() - 1);
+            m_islandStart.push_back(0);
+        }
+        m_pairIsland[i] = island;
+        ++m_islandStart[island + 1];
+    }
+
+    // Group the pairs by island (stable, so each keeps the input order)
+    const std::size_t islandCount = m_islandStart.size() - 1;
+    for (std::size_t island = 0; island < islandCount; ++island) {
+        m_islandStart[island + 1] += m_islandStart[island];
+    }
+    m_islandPairs.resize(m_islandStart.back());
+    m_schedule.assign(m_islandStart.begin(), m_islandStart.end() - 1); // Write cursors for now
+    for (std::size_t i = 0; i < pairs.size(); ++i) {
+        if (m_pairIsland[i] != None) {
+            m_islandPairs[m_schedule[m_pairIsland[i]]++] = static_cast<std::uint32_t>(i);
+        }
+    }
+
+    // Start the largest islands first so one big pile does not finish
+    // last, then cut the schedule into batches
+    for (std::size_t island = 0; island < islandCount; ++island) {
+        m_schedule[island] = static_cast<std::uint32_t>(island);
+    }
+    const auto pairCount = [this](std::uint32_t island) {
+        return m_islandStart[island + 1] - m_islandStart[island];
+    };
+    std::sort(m_schedule.begin(), m_schedule.end(), [&](std::uint32_t a, std::uint32_t b) {
+        return pairCount(a) > pairCount(b) || (pairCount(a) == pairCount(b) && a < b);
+    });
+
+    m_batchStart.assign(1, 0);
+    std::uint32_t batchPairs = 0;
+    for (std::size_t i = 0; i < islandCount; ++i) {
+        batchPairs += pairCount(m_schedule[i]);
+        if (batchPairs >= MinBatchPairs || i + 1 == islandCount) {
+            m_batchStart.push_back(static_cast<std::uint32_t>(i + 1));
+            batchPairs = 0;
+        }
+    }
+
+    const std::size_t batchCount = m_batchStart.size() - 1;
+    if (m_pool && m_pool->getThreadCount() > 1 && batchCount > 1) {
+        m_pool->parallelFor(batchCount, [&](std::size_t batch) {
+            for (std::uint32_t i = m_batchStart[batch]; i < m_batchStart[batch + 1]; ++i) {
+                solveIsland(m_schedule[i], bounds, inverseMasses, pairs);
+            }
+        });
+    } else {
+        for (std::size_t island = 0; island < islandCount; ++island) {
+            solveIsland(island, bounds, inverseMasses, pairs);
+        }
+    }
+}
+
+std::size_t IslandSolver::getIslandCount() const {
+    return m_islandStart.empty() ? 0 : m_islandStart.size() - 1;
+}
+
+std::size_t IslandSolver::getLargestIslandSize() const {
+    std::uint32_t largest = 0;
+    for (std::size_t island = 0; island + 1 < m_islandStart.size(); ++island) {
+        largest = std::max(largest, m_islandStart[island + 1] - m_islandStart[island]);
+    }
+    return largest;
+}
+
+std::uint32_t IslandSolver::find(std::uint32_t body) {
+    // Path halving
+    while (m_parent[body] != body) {
+        m_parent[body] = m_parent[m_parent[body]];
+        body = m_parent[body];
+    }
+    return body;
+}
+
+void IslandSolver::unite(std::uint32_t a, std::uint32_t b) {
+    a = find(a);
+    b = find(b);
+    if (a == b) return;
+    // The lower index becomes the root; islands are numbered by their
+    // pairs, so the choice does not affect the result
+    if (b < a) std::swap(a, b);
+    m_parent[b] = a;
+}
+
+void IslandSolver::solveIsland(std::size_t island, std::span<sf::FloatRect> bounds,
+                               std::span<const float> inverseMasses,
+                               std::span<const CollisionPair> pairs) const {
+    const std::uint32_t begin = m_islandStart[island];
+    const std::uint32_t end = m_islandStart[island + 1];
+
+    for (int iteration = 0; iteration < m_iterations; ++iteration) {
+        for (std::uint32_t k = begin; k < end; ++k) {
+            const CollisionPair& pair = pairs[m_islandPairs[k]];
+            const float weightA = inverseMasses[pair.a];
+            const float weightB = inverseMasses[pair.b];
+
+            const CollisionResult result = Collision::checkAABB(bounds[pair.a], bounds[pair.b]);
+            if (!result.colliding) continue;
+
+            // Static bodies may border several islands: never write to them
+            const float total = weightA + weightB;
+            if (weightA > 0.f) bounds[pair.a].position -= result.overlap * (weightA / total);
+            if (weightB > 0.f) bounds[pair.b].position += result.overlap * (weightB / total);
+        }
+    }
+}
+
+} // namespace Example
@@ -0,0 +1,400 @@
+#include "Example/Physics/SpatialHash.hpp"
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define EXAMPLE_SPATIALHASH_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define EXAMPLE_SPATIALHASH_SSE2 0
+#endif
+
+namespace Example {
+
+namespace {
+
+/// Cell coordinates are clamped so far-away objects cannot overflow int32.
+constexpr float MaxCellCoord = 1 << 30;
+
+/// Smallest bucket table, so tiny scenes do not rehash constantly.
+constexpr std::size_t MinBuckets = 64;
+
+/// Floor of a value already scaled to cells and clamped. Truncates and
+/// corrects negative values instead of std::floor, which is a library call
+/// without SSE4.1.
+std::int32_t floorScaled(float scaled) {
+    const auto truncated = static_cast<std::int32_t>(scaled);
+    return truncated - (scaled < static_cast<float>(truncated));
+}
+
+/// Initial size of the pair buffer (doubles when full, never shrinks).
+constexpr std::size_t MinPairCapacity = 1024;
+
+} // namespace
+
+SpatialHash::SpatialHash(float cellSize) {
+    setCellSize(cellSize);
+}
+
+void SpatialHash::setCellSize(float cellSize) {
+    m_cellSize = cellSize > 0.f ? cellSize : 1.f;
+    m_inverseCellSize = 1.f / m_cellSize;
+    m_built = false;
+    m_pairsValid = false;
+}
+
+float SpatialHash::getCellSize() const {
+    return m_cellSize;
+}
+
+void SpatialHash::clear() {
+    m_boxes.clear();
+    m_filters.clear();
+    m_hasFilters = false;
+    m_pairCount = 0;
+    m_built = false;
+    m_pairsValid = false;
+}
+
+void SpatialHash::reserve(std::size_t count) {
+    m_boxes.reserve(count);
+    m_filters.reserve(count);
+    m_ranges.reserve(count);
+    m_entries.reserve(count * 2);
+}
+
+std::uint32_t SpatialHash::insert(const sf::FloatRect& bounds, const CollisionFilter& filter) {
+    const Box box{bounds.position.x, bounds.position.y,
+                  bounds.position.x + bounds.size.x, bounds.position.y + bounds.size.y};
+    m_boxes.push_back(box);
+    m_filters.push_back(filter);
+    m_hasFilters |= filter.category != CollisionFilter{}.category || filter.mask != CollisionFilter{}.mask;
+    m_built = false;
+    m_pairsValid = false;
+    return static_cast<std::uint32_t>(m_boxes.size() - 1);
+}
+
+std::span<const CollisionPair> SpatialHash::pairs() {
+    if (m_pairsValid) return {m_pairs.data(), m_pairCount};
+    build();
+
+    if (m_pairs.size() < MinPairCapacity) {
+        m_pairs.resize(MinPairCapacity);
+    }
+    std::size_t filtered = 0;
+    if (m_dense) {
+        m_pairCount = m_hasFilters ? collectPairs<false, true>(filtered)
+                                   : collectPairs<false, false>(filtered);
+    } else {
+        m_pairCount = m_hasFilters ? collectPairs<true, true>(filtered)
+                                   : collectPairs<true, false>(filtered);
+    }
+    m_pairsValid = true;
+
+    m_stats.clear();
+    if (m_hasFilters) {
+        for (std::size_t i = 0; i < m_pairCount; ++i) {
+            m_stats.record(m_filters[m_pairs[i].a], m_filters[m_pairs[i].b]);
+        }
+    } else {
+        // Every object is in the default layer (bit 0)
+        m_stats.total = static_cast<std::uint32_t>(m_pairCount);
+        m_stats.pairs[0] = m_stats.total;
+    }
+    m_stats.filtered = static_cast<std::uint32_t>(filtered);
+    return {m_pairs.data(), m_pairCount};
+}
+
+template <bool Hashed, bool Filtered>
+std::size_t SpatialHash::collectPairs(std::size_t& filtered) {
+    // Two objects overlap only if they share a cell, so test the entries of
+    // each bucket against each other. In hash mode, entries of different
+    // cells can share a bucket (skipped). Two objects share every cell
+    // their overlap touches, so a pair is reported only from the first:
+    // the cell in the later of their first columns and the later of their
+    // first rows. Both objects cover the cell, so that is the case exactly
+    // when one of them starts in its column and one starts in its row,
+    // which the entry keys carry as flags.
+    //
+    // Most candidates fail one of the tests, unpredictably, so the tests
+    // are combined without branches: every candidate is written to the
+    // next slot and the count only advances on a hit. Room for a whole row
+    // of candidates is made before the row starts.
+    constexpr std::uint32_t StartsBoth = StartsColumn | StartsRow;
+    std::size_t count = 0;
+
+    const std::size_t bucketCount = m_bucketStart.size() - 1;
+    for (std::size_t bucket = 0; bucket < bucketCount; ++bucket) {
+        const std::uint32_t end = m_bucketStart[bucket + 1];
+        for (std::uint32_t i = m_bucketStart[bucket]; i + 1 < end; ++i) {
+            if (m_pairs.size() < count + (end - i)) {
+                m_pairs.resize(std::max(m_pairs.size() * 2, count + (end - i)));
+            }
+            CollisionPair* out = m_pairs.data();
+
+            const Entry first = m_entries[i];
+#if EXAMPLE_SPATIALHASH_SSE2
+            const __m128 a = _mm_loadu_ps(&first.box.minX);
+            const __m128 aMax = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 2, 3, 2));
+            const __m128 aMin = _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 0, 1, 0));
+#else
+            const Box& a = first.box;
+#endif
+            for (std::uint32_t j = i + 1; j < end; ++j) {
+                const Entry& second = m_entries[j];
+
+#if EXAMPLE_SPATIALHASH_SSE2
+                // Lanes 0-1 of the first test are b.min < a.max, lanes 2-3
+                // of the second are b.max > a.min
+                const __m128 b = _mm_loadu_ps(&second.box.minX);
+                const __m128 tests = _mm_shuffle_ps(_mm_cmplt_ps(b, aMax), _mm_cmpgt_ps(b, aMin),
+                                                    _MM_SHUFFLE(3, 2, 1, 0));
+                const bool overlap = _mm_movemask_ps(tests) == 0xF;
+#else
+                const Box& b = second.box;
+                const bool overlap = (a.minX < b.maxX) & (b.minX < a.maxX)
+                                   & (a.minY < b.maxY) & (b.minY < a.maxY);
+#endif
+                const std::uint32_t starts = (first.key | second.key) & StartsBoth;
+                bool candidate = overlap & (starts == StartsBoth);
+                if constexpr (Hashed) {
+                    candidate &= m_entryCells[i] == m_entryCells[j];
+                }
+
+                // Buckets list objects in ascending order, so first < second
+                out[count] = {first.key & IndexMask, second.key & IndexMask};
+                if constexpr (Filtered) {
+                    const bool accepted = m_entryFilters[i].accepts(m_entryFilters[j]);
+                    count += candidate & accepted;
+                    filtered += candidate & !accepted;
+                } else {
+                    count += candidate;
+                }
+            }
+        }
+    }
+    return count;
+}
+
+void SpatialHash::query(const sf::FloatRect& region, std::vector<std::uint32_t>& out,
+                        std::uint32_t mask) {
+    out.clear();
+    if (m_boxes.empty()) return;
+    build();
+
+    const Box area{region.position.x, region.position.y,
+                   region.position.x + region.size.x, region.position.y + region.size.y};
+    const CellRange areaCells{cellCoord(area.minX), cellCoord(area.minY),
+                              cellCoord(area.maxX), cellCoord(area.maxY)};
+    CellRange range = areaCells;
+    if (m_dense) {
+        // Cells outside the occupied area have no bucket (and no objects)
+        range.x0 = std::max(range.x0, m_extent.x0);
+        range.y0 = std::max(range.y0, m_extent.y0);
+        range.x1 = std::min(range.x1, m_extent.x1);
+        range.y1 = std::min(range.y1, m_extent.y1);
+    }
+
+    for (std::int32_t cy = range.y0; cy <= range.y1; ++cy) {
+        for (std::int32_t cx = range.x0; cx <= range.x1; ++cx) {
+            const std::uint32_t bucket = bucketOf(cx, cy);
+            const std::uint64_t cell = packCell(cx, cy);
+            for (std::uint32_t e = m_bucketStart[bucket]; e < m_bucketStart[bucket + 1]; ++e) {
+                const Entry& entry = m_entries[e];
+                if (!m_dense && m_entryCells[e] != cell) continue;
+                if ((m_filters[entry.key & IndexMask].category & mask) == 0) continue;
+
+                const Box& box = entry.box;
+                if (box.minX >= area.maxX || area.minX >= box.maxX
+                    || box.minY >= area.maxY || area.minY >= box.maxY) {
+                    continue;
+                }
+                // Same de-duplication rule as pairs(), with the region as the other object
+                if (!((entry.key & StartsColumn) || cx == areaCells.x0)
+                    || !((entry.key & StartsRow) || cy == areaCells.y0)) {
+                    continue;
+                }
+                out.push_back(entry.key & IndexMask);
+            }
+        }
+    }
+}
+
+const LayerPairStats& SpatialHash::getLayerStats() const {
+    return m_stats;
+}
+
+sf::FloatRect SpatialHash::getBounds(std::uint32_t index) const {
+    const Box& box = m_boxes[index];
+    return sf::FloatRect({box.minX, box.minY}, {box.maxX - box.minX, box.maxY - box.minY});
+}
+
+std::size_t SpatialHash::size() const {
+    return m_boxes.size();
+}
+
+void SpatialHash::build() {
+    if (m_built) return;
+
+    // Cell ranges depend on the cell size, so they are computed here
+    computeRanges();
+
+    // If the occupied area has no more cells than the hash table would have
+    // buckets, index the cells directly: no hashing and no two cells sharing
+    // a bucket. Sparse or unbounded worlds fall back to hashing.
+    const std::size_t hashBuckets = std::bit_ceil(std::max(MinBuckets, m_boxes.size() * 2));
+    const std::int64_t width = std::int64_t{m_extent.x1} - m_extent.x0 + 1;
+    const std::int64_t height = std::int64_t{m_extent.y1} - m_extent.y0 + 1;
+    m_dense = !m_boxes.empty() && width * height <= static_cast<std::int64_t>(hashBuckets);
+
+    std::size_t bucketCount = hashBuckets;
+    if (m_dense) {
+        m_gridWidth = static_cast<std::uint32_t>(width);
+        bucketCount = static_cast<std::size_t>(width * height);
+    }
+    m_bucketMask = static_cast<std::uint32_t>(hashBuckets - 1);
+
+    // Counting sort of (object, cell) entries into buckets: count, prefix
+    // sum, then fill backwards so each bucket lists objects in ascending order
+    m_bucketStart.assign(bucketCount + 1, 0);
+
+    // Most objects cover one to four cells, and whether one crosses a column
+    // or row boundary is unpredictable. Those are handled as a 2x2 block
+    // whose second column and row only count when covered, without branches.
+    for (const CellRange& range : m_ranges) {
+        if (isSmall(range)) {
+            const bool wide = range.x1 != range.x0;
+            const bool tall = range.y1 != range.y0;
+            ++m_bucketStart[bucketOf(range.x0, range.y0)];
+            m_bucketStart[bucketOf(range.x1, range.y0)] += wide;
+            m_bucketStart[bucketOf(range.x0, range.y1)] += tall;
+            m_bucketStart[bucketOf(range.x1, range.y1)] += wide & tall;
+            continue;
+        }
+        for (std::int32_t cy = range.y0; cy <= range.y1; ++cy) {
+            for (std::int32_t cx = range.x0; cx <= range.x1; ++cx) {
+                ++m_bucketStart[bucketOf(cx, cy)];
+            }
+        }
+    }
+
+    std::uint32_t total = 0;
+    for (std::size_t b = 0; b < bucketCount; ++b) {
+        total += m_bucketStart[b];
+        m_bucketStart[b] = total; // End of bucket b for now
+    }
+    m_bucketStart[bucketCount] = total;
+    // One slot past the end takes the writes for uncovered cells of a 2x2 block
+    m_entries.resize(total + 1);
+    m_entryCells.resize(m_dense ? 0 : total + 1);
+    m_entryFilters.resize(m_hasFilters ? total + 1 : 0);
+
+    const auto place = [&](std::size_t i, const Box& box, std::int32_t cx, std::int32_t cy,
+                           std::uint32_t flags, bool covered) {
+        std::uint32_t& start = m_bucketStart[bucketOf(cx, cy)];
+        start -= covered;
+        const std::uint32_t slot = covered ? start : total;
+        m_entries[slot] = {box, static_cast<std::uint32_t>(i) | flags};
+        if (!m_dense) m_entryCells[slot] = packCell(cx, cy);
+        if (m_hasFilters) m_entryFilters[slot] = m_filters[i];
+    };
+
+    for (std::size_t i = m_ranges.size(); i-- > 0;) {
+        const CellRange range = m_ranges[i];
+        const Box box = m_boxes[i];
+        if (isSmall(range)) {
+            const bool wide = range.x1 != range.x0;
+            const bool tall = range.y1 != range.y0;
+            place(i, box, range.x0, range.y0, StartsColumn | StartsRow, true);
+            place(i, box, range.x1, range.y0, StartsRow, wide);
+            place(i, box, range.x0, range.y1, StartsColumn, tall);
+            place(i, box, range.x1, range.y1, 0u, wide & tall);
+            continue;
+        }
+        for (std::int32_t cy = range.y0; cy <= range.y1; ++cy) {
+            const std::uint32_t row = cy == range.y0 ? StartsRow : 0u;
+            for (std::int32_t cx = range.x0; cx <= range.x1; ++cx) {
+                place(i, box, cx, cy, row | (cx == range.x0 ? StartsColumn : 0u), true);
+            }
+        }
+    }
+
+    m_built = true;
+}
+
+void SpatialHash::computeRanges() {
+    m_ranges.resize(m_boxes.size());
+    m_extent = {std::numeric_limits<std::int32_t>::max(), std::numeric_limits<std::int32_t>::max(),
+                std::numeric_limits<std::int32_t>::min(), std::numeric_limits<std::int32_t>::min()};
+    if (m_boxes.empty()) return;
+
+    std::size_t i = 0;
+#if EXAMPLE_SPATIALHASH_SSE2
+    // A Box and a CellRange are both four packed lanes (minX, minY, maxX,
+    // maxY), so one box is converted per step. Cell coordinates are
+    // monotonic in the scaled values, so the extent is taken on those and
+    // converted once at the end.
+    static_assert(sizeof(Box) == sizeof(__m128) && sizeof(CellRange) == sizeof(__m128i));
+    const __m128 scale = _mm_set1_ps(m_inverseCellSize);
+    const __m128 limit = _mm_set1_ps(MaxCellCoord);
+    const __m128 negativeLimit = _mm_set1_ps(-MaxCellCoord);
+    __m128 low = _mm_set1_ps(MaxCellCoord);
+    __m128 high = negativeLimit;
+    for (; i < m_boxes.size(); ++i) {
+        __m128 scaled = _mm_mul_ps(_mm_loadu_ps(&m_boxes[i].minX), scale);
+        scaled = _mm_min_ps(_mm_max_ps(scaled, negativeLimit), limit);
+        low = _mm_min_ps(low, scaled);
+        high = _mm_max_ps(high, scaled);
+
+        // Truncate, then subtract 1 where that rounded up (negative values);
+        // the comparison mask is -1 in those lanes
+        const __m128i truncated = _mm_cvttps_epi32(scaled);
+        const __m128 roundedUp = _mm_cmplt_ps(scaled, _mm_cvtepi32_ps(truncated));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&m_ranges[i]),
+                         _mm_add_epi32(truncated, _mm_castps_si128(roundedUp)));
+    }
+
+    float lowLanes[4];
+    float highLanes[4];
+    _mm_storeu_ps(lowLanes, low);
+    _mm_storeu_ps(highLanes, high);
+    m_extent = {floorScaled(lowLanes[0]), floorScaled(lowLanes[1]),
+                floorScaled(highLanes[2]), floorScaled(highLanes[3])};
+#endif
+    for (; i < m_boxes.size(); ++i) {
+        const Box& box = m_boxes[i];
+        const CellRange range{cellCoord(box.minX), cellCoord(box.minY),
+                              cellCoord(box.maxX), cellCoord(box.maxY)};
+        m_ranges[i] = range;
+        m_extent.x0 = std::min(m_extent.x0, range.x0);
+        m_extent.y0 = std::min(m_extent.y0, range.y0);
+        m_extent.x1 = std::max(m_extent.x1, range.x1);
+        m_extent.y1 = std::max(m_extent.y1, range.y1);
+    }
+}
+
+bool SpatialHash::isSmall(const CellRange& range) {
+    return static_cast<std::uint32_t>(range.x1 - range.x0) <= 1
+        && static_cast<std::uint32_t>(range.y1 - range.y0) <= 1;
+}
+
+std::int32_t SpatialHash::cellCoord(float value) const {
+    return floorScaled(std::clamp(value * m_inverseCellSize, -MaxCellCoord, MaxCellCoord));
+}
+
+std::uint32_t SpatialHash::bucketOf(std::int32_t cx, std::int32_t cy) const {
+    if (m_dense) {
+        return static_cast<std::uint32_t>(cx - m_extent.x0)
+             + static_cast<std::uint32_t>(cy - m_extent.y0) * m_gridWidth;
+    }
+    const auto h = static_cast<std::uint32_t>(cx) * 73856093u
+                 ^ static_cast<std::uint32_t>(cy) * 19349663u;
+    return h & m_bucketMask;
+}
+
+std::uint64_t SpatialHash::packCell(std::int32_t cx, std::int32_t cy) {
+    return (std::uint64_t{static_cast<std::uint32_t>(cx)} << 32) | static_cast<std::uint32_t>(cy);
+}
+
+} // namespace Example
@@ -0,0 +1,334 @@
+#include "Example/Physics/SweepAndPrune.hpp"
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <string>
+
+namespace Example {
+
+namespace {
+
+/// Endpoint order. On equal values a max sorts before a min, matching the
+/// strict overlap test (touching intervals do not overlap). A proxy with no
+/// extent on the axis has both endpoints at one value; they sort between
+/// the maxes and the mins, its min first, so it opens before it closes.
+template <typename Endpoint>
+bool before(const Endpoint& a, const Endpoint& b) {
+    return a.value < b.value || (a.value == b.value && a.tieOrder() < b.tieOrder());
+}
+
+} // namespace
+
+SweepAndPrune::ProxyId SweepAndPrune::add(const sf::FloatRect& bounds, const CollisionFilter& filter) {
+    ProxyId id;
+    if (!m_freeIds.empty()) {
+        id = m_freeIds.back();
+        m_freeIds.pop_back();
+    } else {
+        if (m_proxies.size() >= FlatFlag) {
+            throw std::runtime_error("SweepAndPrune: Too many proxies -> " + std::to_string(m_proxies.size()));
+        }
+        id = static_cast<ProxyId>(m_proxies.size());
+        m_proxies.emplace_back();
+    }
+
+    Proxy& proxy = m_proxies[id];
+    proxy.filter = filter;
+    proxy.live = true;
+    proxy.removed = false;
+    ++m_liveCount;
+    ++m_addedSinceStep;
+    update(id, bounds);
+
+    // Appended at the end; the next step() sorts them into place, which
+    // also finds the new proxy's pairs
+    for (int axis = 0; axis < 2; ++axis) {
+        m_endpoints[axis].push_back({proxy.min[axis], id});
+        m_endpoints[axis].push_back({proxy.max[axis], id | MaxFlag});
+    }
+    return id;
+}
+
+void SweepAndPrune::remove(ProxyId id) {
+    if (!isValid(id)) return;
+    Proxy& proxy = m_proxies[id];
+    proxy.live = false;
+    proxy.removed = true;
+    --m_liveCount;
+    m_hasRemovals = true;
+}
+
+void SweepAndPrune::update(ProxyId id, const sf::FloatRect& bounds) {
+    if (!isValid(id)) {
+        throw std::runtime_error("SweepAndPrune: Invalid proxy -> " + std::to_string(id));
+    }
+    Proxy& proxy = m_proxies[id];
+    proxy.min[0] = bounds.position.x;
+    proxy.min[1] = bounds.position.y;
+    proxy.max[0] = bounds.position.x + bounds.size.x;
+    proxy.max[1] = bounds.position.y + bounds.size.y;
+}
+
+void SweepAndPrune::setFilter(ProxyId id, const CollisionFilter& filter) {
+    if (!isValid(id)) {
+        throw std::runtime_error("SweepAndPrune: Invalid proxy -> " + std::to_string(id));
+    }
+    m_proxies[id].filter = filter;
+    m_filtersChanged = true;
+}
+
+const CollisionFilter& SweepAndPrune::getFilter(ProxyId id) const {
+    if (!isValid(id)) {
+        throw std::runtime_error("SweepAndPrune: Invalid proxy -> " + std::to_string(id));
+    }
+    return m_proxies[id].filter;
+}
+
+void SweepAndPrune::step() {
+    m_added.clear();
+    m_removed.clear();
+    m_stats.filtered = 0;
+
+    if (m_hasRemovals) {
+        purgeRemoved();
+    }
+
+    // Each appended endpoint may travel the whole list in the insertion
+    // sort; beyond a few of them a full sort is cheaper. Swaps only see
+    // pairs that start or stop overlapping, so a filter change, which can
+    // affect pairs that keep overlapping, also needs the full pass.
+    const bool bulk = m_addedSinceStep > std::bit_width(m_endpoints[0].size()) || m_filtersChanged;
+    m_addedSinceStep = 0;
+    m_filtersChanged = false;
+    if (bulk) {
+        rebuild();
+    } else {
+        sortAxis(0);
+        sortAxis(1);
+    }
+
+    const std::uint32_t filtered = m_stats.filtered;
+    m_stats.clear();
+    m_stats.filtered = filtered;
+    for (const CollisionPair& pair : m_pairs) {
+        m_stats.record(m_proxies[pair.a].filter, m_proxies[pair.b].filter);
+    }
+}
+
+std::span<const CollisionPair> SweepAndPrune::getAddedPairs() const {
+    return m_added;
+}
+
+std::span<const CollisionPair> SweepAndPrune::getRemovedPairs() const {
+    return m_removed;
+}
+
+std::span<const CollisionPair> SweepAndPrune::getPairs() const {
+    return m_pairs;
+}
+
+bool SweepAndPrune::isOverlapping(ProxyId a, ProxyId b) const {
+    return m_pairIndex.contains(pairKey(a, b));
+}
+
+const LayerPairStats& SweepAndPrune::getLayerStats() const {
+    return m_stats;
+}
+
+CollisionResult SweepAndPrune::check(const CollisionPair& pair) const {
+    return Collision::checkAABB(getBounds(pair.a), getBounds(pair.b));
+}
+
+sf::FloatRect SweepAndPrune::getBounds(ProxyId id) const {
+    const Proxy& proxy = m_proxies[id];
+    return sf::FloatRect({proxy.min[0], proxy.min[1]},
+                         {proxy.max[0] - proxy.min[0], proxy.max[1] - proxy.min[1]});
+}
+
+bool SweepAndPrune::isValid(ProxyId id) const {
+    return id < m_proxies.size() && m_proxies[id].live;
+}
+
+std::size_t SweepAndPrune::size() const {
+    return m_liveCount;
+}
+
+void SweepAndPrune::clear() {
+    m_proxies.clear();
+    m_freeIds.clear();
+    m_endpoints[0].clear();
+    m_endpoints[1].clear();
+    m_liveCount = 0;
+    m_hasRemovals = false;
+    m_filtersChanged = false;
+    m_pairs.clear();
+    m_pairIndex.clear();
+    m_added.clear();
+    m_removed.clear();
+    m_stats.clear();
+}
+
+void SweepAndPrune::refreshValues(int axis) {
+    for (Endpoint& endpoint : m_endpoints[axis]) {
+        const Proxy& proxy = m_proxies[endpoint.proxy()];
+        endpoint.value = endpoint.isMax() ? proxy.max[axis] : proxy.min[axis];
+        const bool flat = proxy.max[axis] == proxy.min[axis];
+        endpoint.data = (endpoint.data & ~FlatFlag) | (flat ? FlatFlag : 0u);
+    }
+}
+
+void SweepAndPrune::sortAxis(int axis) {
+    std::vector<Endpoint>& endpoints = m_endpoints[axis];
+    refreshValues(axis);
+
+    for (std::size_t i = 1; i < endpoints.size(); ++i) {
+        const Endpoint key = endpoints[i];
+        std::size_t j = i;
+        while (j > 0 && before(key, endpoints[j - 1])) {
+            const Endpoint& other = endpoints[j - 1];
+            if (other.proxy() != key.proxy() && key.isMax() != other.isMax()) {
+                if (!key.isMax()) {
+                    // A min passed a max: the intervals now overlap on this axis
+                    if (overlaps(key.proxy(), other.proxy())) {
+                        addPairIfAccepted(key.proxy(), other.proxy());
+                    }
+                } else {
+                    // A max passed a min: the intervals separated on this axis
+                    removePair(key.proxy(), other.proxy());
+                }
+            }
+            endpoints[j] = other;
+            --j;
+        }
+        endpoints[j] = key;
+    }
+}
+
+void SweepAndPrune::rebuild() {
+    for (int axis = 0; axis < 2; ++axis) {
+        refreshValues(axis);
+        std::sort(m_endpoints[axis].begin(), m_endpoints[axis].end(),
+                  [](const Endpoint& a, const Endpoint& b) { return before(a, b); });
+    }
+
+    // Sweep along x keeping the proxies whose interval is open; every
+    // proxy opening tests the open ones
+    m_active.clear();
+    m_found.clear();
+    for (const Endpoint& endpoint : m_endpoints[0]) {
+        const ProxyId id = endpoint.proxy();
+        if (endpoint.isMax()) {
+            // Not open if its bounds have a negative size (see below)
+            const auto it = std::find(m_active.begin(), m_active.end(), id);
+            if (it != m_active.end()) {
+                *it = m_active.back();
+                m_active.pop_back();
+            }
+            continue;
+        }
+        for (const ProxyId other : m_active) {
+            if (!overlaps(id, other)) continue;
+            if (m_proxies[id].filter.accepts(m_proxies[other].filter)) {
+                m_found.push_back({std::min(id, other), std::max(id, other)});
+            } else {
+                ++m_stats.filtered;
+            }
+        }
+        // Bounds with a negative size closed before they opened: they are
+        // tested against the open proxies, but nothing opening later can
+        // start before their max
+        if (m_proxies[id].max[0] >= m_proxies[id].min[0]) {
+            m_active.push_back(id);
+        }
+    }
+
+    // Report only the differences from the previous pair set
+    m_kept.assign(m_pairs.size(), false);
+    for (const CollisionPair& pair : m_found) {
+        const auto it = m_pairIndex.find(pairKey(pair.a, pair.b));
+        if (it != m_pairIndex.end()) {
+            m_kept[it->second] = true;
+        }
+    }
+    for (std::size_t i = m_kept.size(); i-- > 0;) {
+        if (!m_kept[i]) {
+            removePair(m_pairs[i].a, m_pairs[i].b); // Moves the last pair (already visited) into i
+        }
+    }
+    for (const CollisionPair& pair : m_found) {
+        addPair(pair.a, pair.b);
+    }
+}
+
+void SweepAndPrune::purgeRemoved() {
+    // Report and drop the pairs of removed proxies
+    for (std::size_t i = 0; i < m_pairs.size();) {
+        const CollisionPair pair = m_pairs[i];
+        if (m_proxies[pair.a].removed || m_proxies[pair.b].removed) {
+            removePair(pair.a, pair.b); // Swap-pops index i
+        } else {
+            ++i;
+        }
+    }
+
+    for (std::vector<Endpoint>& endpoints : m_endpoints) {
+        std::erase_if(endpoints, [this](const Endpoint& endpoint) {
+            return m_proxies[endpoint.proxy()].removed;
+        });
+    }
+
+    for (ProxyId id = 0; id < m_proxies.size(); ++id) {
+        if (m_proxies[id].removed) {
+            m_proxies[id].removed = false;
+            m_freeIds.push_back(id);
+        }
+    }
+    m_hasRemovals = false;
+}
+
+bool SweepAndPrune::overlaps(ProxyId a, ProxyId b) const {
+    const Proxy& pa = m_proxies[a];
+    const Proxy& pb = m_proxies[b];
+    return pa.min[0] < pb.max[0] && pb.min[0] < pa.max[0]
+        && pa.min[1] < pb.max[1] && pb.min[1] < pa.max[1];
+}
+
+void SweepAndPrune::addPairIfAccepted(ProxyId a, ProxyId b) {
+    if (m_proxies[a].filter.accepts(m_proxies[b].filter)) {
+        addPair(a, b);
+    } else {
+        ++m_stats.filtered;
+    }
+}
+
+void SweepAndPrune::addPair(ProxyId a, ProxyId b) {
+    const auto [it, inserted] = m_pairIndex.try_emplace(pairKey(a, b),
+                                                        static_cast<std::uint32_t>(m_pairs.size()));
+    if (!inserted) return; // Already found on the other axis
+
+    const CollisionPair pair{std::min(a, b), std::max(a, b)};
+    m_pairs.push_back(pair);
+    m_added.push_back(pair);
+}
+
+void SweepAndPrune::removePair(ProxyId a, ProxyId b) {
+    const auto it = m_pairIndex.find(pairKey(a, b));
+    if (it == m_pairIndex.end()) return;
+
+    const std::uint32_t index = it->second;
+    m_pairIndex.erase(it);
+    m_removed.push_back(m_pairs[index]);
+
+    if (index + 1 != m_pairs.size()) {
+        m_pairs[index] = m_pairs.back();
+        m_pairIndex[pairKey(m_pairs[index].a, m_pairs[index].b)] = index;
+    }
+    m_pairs.pop_back();
+}
+
+std::uint64_t SweepAndPrune::pairKey(ProxyId a, ProxyId b) {
+    if (a > b) std::swap(a, b);
+    return (std::uint64_t{a} << 32) | b;
+}
+
+} // namespace Example
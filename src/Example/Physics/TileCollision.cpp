@@ -0,0 +1,251 @@
+#include "Example/Physics/TileCollision.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Example {
+
+namespace {
+
+/// Tolerance in cells: a rect placed flush against a cell edge by an
+/// earlier resolve() may be off by a rounding error, and must still count
+/// as touching (not overlapping) that cell.
+constexpr float Epsilon = 1e-4f;
+
+int floorCell(float value) {
+    return static_cast<int>(std::floor(value));
+}
+
+int ceilCell(float value) {
+    return static_cast<int>(std::ceil(value));
+}
+
+bool isSlope(TileShape shape) {
+    return shape == TileShape::SlopeUpRight || shape == TileShape::SlopeUpLeft;
+}
+
+} // namespace
+
+TileCollision::TileCollision(sf::Vector2u mapSize, sf::Vector2f tileSize)
+    : m_mapSize(mapSize)
+    , m_tileSize(tileSize)
+    , m_cells(static_cast<std::size_t>(mapSize.x) * mapSize.y, TileShape::Empty) {
+}
+
+void TileCollision::setTile(sf::Vector2u cell, TileShape shape) {
+    if (cell.x >= m_mapSize.x || cell.y >= m_mapSize.y) return;
+    m_cells[static_cast<std::size_t>(cell.y) * m_mapSize.x + cell.x] = shape;
+}
+
+TileShape TileCollision::getTile(sf::Vector2u cell) const {
+    if (cell.x >= m_mapSize.x || cell.y >= m_mapSize.y) return TileShape::Empty;
+    return m_cells[static_cast<std::size_t>(cell.y) * m_mapSize.x + cell.x];
+}
+
+void TileCollision::fill(TileShape shape) {
+    std::fill(m_cells.begin(), m_cells.end(), shape);
+}
+
+CollisionResult TileCollision::resolve(const sf::FloatRect& bounds, sf::Vector2f displacement) const {
+    // Work in grid-local coordinates
+    sf::Vector2f position = bounds.position - m_position;
+    const sf::Vector2f target = position + displacement;
+
+    // The x pass may step the rect onto a low lip, but not while it rises
+    position.x = sweepX(position, bounds.size, displacement.x, displacement.y >= 0.f);
+    position.y = sweepY(position, bounds.size, displacement.y);
+    if (displacement.y >= 0.f) {
+        position.y = restOnSlopes(position, bounds.size);
+    }
+
+    CollisionResult result;
+    result.overlap = target - position;
+    result.colliding = result.overlap.x != 0.f || result.overlap.y != 0.f;
+    return result;
+}
+
+bool TileCollision::overlapsSolid(const sf::FloatRect& bounds) const {
+    const sf::Vector2f position = bounds.position - m_position;
+    const int c0 = floorCell(position.x / m_tileSize.x + Epsilon);
+    const int c1 = ceilCell((position.x + bounds.size.x) / m_tileSize.x - Epsilon) - 1;
+    const int r0 = floorCell(position.y / m_tileSize.y + Epsilon);
+    const int r1 = ceilCell((position.y + bounds.size.y) / m_tileSize.y - Epsilon) - 1;
+
+    for (int r = std::max(r0, 0); r <= std::min(r1, static_cast<int>(m_mapSize.y) - 1); ++r) {
+        for (int c = std::max(c0, 0); c <= std::min(c1, static_cast<int>(m_mapSize.x) - 1); ++c) {
+            if (at(c, r) == TileShape::Solid) return true;
+        }
+    }
+    return false;
+}
+
+sf::Vector2i TileCollision::cellAt(sf::Vector2f point) const {
+    const sf::Vector2f local = point - m_position;
+    return {floorCell(local.x / m_tileSize.x), floorCell(local.y / m_tileSize.y)};
+}
+
+void TileCollision::setPosition(sf::Vector2f position) {
+    m_position = position;
+}
+
+sf::Vector2f TileCollision::getPosition() const {
+    return m_position;
+}
+
+sf::Vector2u TileCollision::getMapSize() const {
+    return m_mapSize;
+}
+
+sf::Vector2f TileCollision::getTileSize() const {
+    return m_tileSize;
+}
+
+TileShape TileCollision::at(int x, int y) const {
+    if (x < 0 || y < 0 || x >= static_cast<int>(m_mapSize.x) || y >= static_cast<int>(m_mapSize.y)) {
+        return TileShape::Empty;
+    }
+    return m_cells[static_cast<std::size_t>(y) * m_mapSize.x + static_cast<std::size_t>(x)];
+}
+
+float TileCollision::sweepX(sf::Vector2f& position, sf::Vector2f size, float dx, bool canStep) const {
+    if (dx == 0.f) return position.x;
+    const float tw = m_tileSize.x;
+    const float th = m_tileSize.y;
+
+    // Rows the rect covers (touching a row's edge does not count)
+    int r0 = floorCell(position.y / th + Epsilon);
+    int r1 = ceilCell((position.y + size.y) / th - Epsilon) - 1;
+
+    // Whether column c stops the rect. A Solid only in the bottom row whose
+    // top is within |dx| of the rect's bottom is stepped onto instead,
+    // provided the rows the lifted rect newly covers are clear from the
+    // rect's trailing column up to c.
+    const auto blocks = [&](int c) {
+        bool lowLip = false;
+        for (int r = r0; r <= r1; ++r) {
+            if (at(c, r) != TileShape::Solid) continue;
+            const float lift = position.y + size.y - static_cast<float>(r) * th;
+            if (r != r1 || !canStep || lift > std::abs(dx)) return true;
+            lowLip = true;
+        }
+        if (!lowLip) return false;
+
+        const float liftedY = static_cast<float>(r1) * th - size.y;
+        const int liftedR0 = floorCell(liftedY / th + Epsilon);
+        const int from = dx > 0.f ? floorCell(position.x / tw + Epsilon) : c;
+        const int to = dx > 0.f ? c : ceilCell((position.x + size.x) / tw - Epsilon) - 1;
+        for (int r = liftedR0; r < r0; ++r) {
+            for (int column = from; column <= to; ++column) {
+                if (at(column, r) == TileShape::Solid) return true;
+            }
+        }
+        position.y = liftedY;
+        r0 = liftedR0;
+        --r1;
+        return false;
+    };
+
+    if (dx > 0.f) {
+        // Columns ahead of the right edge, up to where it ends
+        const float edge = position.x + size.x;
+        const int first = std::max(ceilCell(edge / tw - Epsilon), 0);
+        const int last = std::min(ceilCell((edge + dx) / tw - Epsilon) - 1,
+                                  static_cast<int>(m_mapSize.x) - 1);
+        for (int c = first; c <= last; ++c) {
+            if (blocks(c)) return static_cast<float>(c) * tw - size.x;
+        }
+    } else {
+        const float edge = position.x;
+        const int first = std::min(floorCell(edge / tw + Epsilon) - 1, static_cast<int>(m_mapSize.x) - 1);
+        const int last = std::max(floorCell((edge + dx) / tw + Epsilon), 0);
+        for (int c = first; c >= last; --c) {
+            if (blocks(c)) return static_cast<float>(c + 1) * tw;
+        }
+    }
+    return position.x + dx;
+}
+
+float TileCollision::sweepY(sf::Vector2f position, sf::Vector2f size, float dy) const {
+    if (dy == 0.f) return position.y;
+    const float tw = m_tileSize.x;
+    const float th = m_tileSize.y;
+
+    const int c0 = std::max(floorCell(position.x / tw + Epsilon), 0);
+    const int c1 = std::min(ceilCell((position.x + size.x) / tw - Epsilon) - 1,
+                            static_cast<int>(m_mapSize.x) - 1);
+
+    if (dy > 0.f) {
+        // Falling: Solid and OneWay tops stop the rect; rows start below
+        // its bottom, so a one-way platform it is inside never catches it.
+        // Slope surfaces stop it too, from the row its bottom is in: a
+        // surface at or below the bottom is landed on, however far the
+        // move goes past it
+        const float edge = position.y + size.y;
+        const float target = edge + dy;
+        const int first = std::max(ceilCell(edge / th - Epsilon), 0);
+        const int last = std::min(ceilCell(target / th - Epsilon) - 1,
+                                  static_cast<int>(m_mapSize.y) - 1);
+        for (int r = std::max(floorCell(edge / th - Epsilon), 0); r <= last; ++r) {
+            if (r >= first) {
+                for (int c = c0; c <= c1; ++c) {
+                    const TileShape shape = at(c, r);
+                    if (shape == TileShape::Solid || shape == TileShape::OneWay) {
+                        return static_cast<float>(r) * th - size.y;
+                    }
+                }
+            }
+            const float surface = slopeSurface(r, position.x, size.x);
+            if (surface >= edge - Epsilon * th && surface <= target) {
+                return surface - size.y;
+            }
+        }
+    } else {
+        const float edge = position.y;
+        const int first = std::min(floorCell(edge / th + Epsilon) - 1, static_cast<int>(m_mapSize.y) - 1);
+        const int last = std::max(floorCell((edge + dy) / th + Epsilon), 0);
+        for (int r = first; r >= last; --r) {
+            for (int c = c0; c <= c1; ++c) {
+                if (at(c, r) == TileShape::Solid) {
+                    return static_cast<float>(r + 1) * th;
+                }
+            }
+        }
+    }
+    return position.y + dy;
+}
+
+float TileCollision::restOnSlopes(sf::Vector2f position, sf::Vector2f size) const {
+    const float th = m_tileSize.y;
+    const float bottom = position.y + size.y;
+
+    // Slopes in the row just above the bottom edge; at most one cell of lift
+    const float surface = slopeSurface(floorCell(bottom / th - Epsilon), position.x, size.x);
+    if (surface >= bottom) return position.y;
+
+    // Never lift into a ceiling
+    const sf::Vector2f lifted{position.x, surface - size.y};
+    return overlapsSolid({lifted + m_position, size}) ? position.y : lifted.y;
+}
+
+float TileCollision::slopeSurface(int row, float x, float width) const {
+    const float tw = m_tileSize.x;
+    const float th = m_tileSize.y;
+    const int c0 = floorCell(x / tw + Epsilon);
+    const int c1 = ceilCell((x + width) / tw - Epsilon) - 1;
+
+    float surface = std::numeric_limits<float>::infinity();
+    for (int c = c0; c <= c1; ++c) {
+        const TileShape shape = at(c, row);
+        if (!isSlope(shape)) continue;
+
+        // The rect rests on its uphill bottom corner, clamped into the cell
+        const float left = static_cast<float>(c) * tw;
+        const float corner = shape == TileShape::SlopeUpRight ? x + width : x;
+        const float u = (std::clamp(corner, left, left + tw) - left) / tw;
+        const float height = shape == TileShape::SlopeUpRight ? 1.f - u : u;
+        surface = std::min(surface, static_cast<float>(row) * th + height * th);
+    }
+    return surface;
+}
+
+} // namespace Example
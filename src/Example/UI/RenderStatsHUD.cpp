@@ -0,0 +1,88 @@
+#include "Example/UI/RenderStatsHUD.hpp"
+#include "Engine/Graphics/Renderer.hpp"
+#include <iomanip>
+#include <sstream>
+
+namespace Example {
+
+namespace {
+
+constexpr unsigned int CharacterSize = 14;
+constexpr float Padding = 8.f;
+
+// Layout of rebuildText(): six lines of a 14-character label and three
+// 7-wide columns separated by "  avg " and "  peak "
+constexpr float LineCount = 6.f;
+constexpr float ColumnCount = 14.f + 7.f + 6.f + 7.f + 7.f + 7.f;
+
+/// Approximate advance of a digit or letter, in ems.
+constexpr float AverageAdvance = 0.6f;
+
+void appendCounter(std::ostringstream& out, const char* label,
+                   std::size_t last, std::size_t average, std::size_t peak) {
+    out << std::left << std::setw(14) << label << std::right << std::setw(7) << last
+        << "  avg " << std::setw(7) << average << "  peak " << std::setw(7) << peak << '\n';
+}
+
+} // namespace
+
+RenderStatsHUD::RenderStatsHUD(const Engine::RenderStatsRecorder& stats, const sf::Font& font)
+    : m_stats(stats)
+    , m_text(font, "", CharacterSize) {
+    m_text.setFillColor(sf::Color::White);
+    m_text.setPosition({16.f, 12.f});
+
+    // Sized from the fixed layout: measuring the text would load glyphs
+    // into the font, which the render thread may be drawing from
+    const sf::Vector2f textSize{ColumnCount * AverageAdvance * static_cast<float>(CharacterSize),
+                                LineCount * font.getLineSpacing(CharacterSize)};
+    m_background.setFillColor(sf::Color(0, 0, 0, 160));
+    m_background.setPosition({8.f, 8.f});
+    m_background.setSize(m_text.getPosition() - m_background.getPosition() + textSize + sf::Vector2f{Padding, Padding});
+}
+
+void RenderStatsHUD::update(float dt) {
+    m_sinceRefresh += dt;
+    if (m_sinceRefresh >= m_refreshInterval) {
+        m_sinceRefresh = 0.f;
+        m_dirty = true;
+    }
+}
+
+void RenderStatsHUD::draw(Engine::Renderer& renderer) {
+    if (!m_visible) return;
+
+    if (m_dirty) {
+        rebuildText();
+        m_dirty = false;
+    }
+
+    renderer.draw(m_background);
+    renderer.draw(m_text);
+}
+
+void RenderStatsHUD::setRefreshInterval(float seconds) {
+    m_refreshInterval = seconds;
+}
+
+void RenderStatsHUD::rebuildText() {
+    const Engine::RenderStats last = m_stats.getLast();
+    const Engine::RenderStats average = m_stats.getAverage();
+    const Engine::RenderStats peak = m_stats.getPeak();
+
+    std::ostringstream out;
+    appendCounter(out, "Draw calls", last.drawCalls, average.drawCalls, peak.drawCalls);
+    appendCounter(out, "Vertices", last.vertices, average.vertices, peak.vertices);
+    appendCounter(out, "Texture binds", last.textureBinds, average.textureBinds, peak.textureBinds);
+    appendCounter(out, "View changes", last.viewChanges, average.viewChanges, peak.viewChanges);
+    appendCounter(out, "Clears", last.clears, average.clears, peak.clears);
+    out << std::left << std::setw(14) << "Display (ms)" << std::right << std::fixed
+        << std::setprecision(2)
+        << std::setw(7) << last.displayTime * 1000.f
+        << "  avg " << std::setw(7) << average.displayTime * 1000.f
+        << "  peak " << std::setw(7) << peak.displayTime * 1000.f;
+
+    m_text.setString(out.str());
+}
+
+} // namespace Example